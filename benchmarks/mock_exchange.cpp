@@ -0,0 +1,224 @@
+#include "mock_exchange.hpp"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace hyperliquid {
+namespace bench {
+
+namespace {
+
+const std::string META_RESPONSE =
+    R"({"universe":[{"name":"BTC","szDecimals":5,"maxLeverage":50},)"
+    R"({"name":"ETH","szDecimals":4,"maxLeverage":50},)"
+    R"({"name":"SOL","szDecimals":2,"maxLeverage":20}]})";
+
+const std::string SPOT_META_RESPONSE =
+    R"({"tokens":[)"
+    R"({"name":"USDC","szDecimals":8,"weiDecimals":8,"index":0,)"
+    R"("tokenId":"0x6d1e7cde53ba9467b783cb7c530ce054","isCanonical":true},)"
+    R"({"name":"PURR","szDecimals":0,"weiDecimals":5,"index":1,)"
+    R"("tokenId":"0xc1fb593aeffbeb02f85e0308e9956a90","isCanonical":true}],)"
+    R"("universe":[{"name":"PURR/USDC","tokens":[1,0],"index":0,"isCanonical":true}]})";
+
+const std::string ALL_MIDS_RESPONSE =
+    R"({"BTC":"43250.5","ETH":"2301.25","SOL":"98.415","PURR/USDC":"0.18523"})";
+
+bool sendAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+size_t contentLength(const std::string& headers) {
+    std::string lower(headers);
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    size_t pos = lower.find("\r\ncontent-length:");
+    if (pos == std::string::npos) {
+        return 0;
+    }
+    return static_cast<size_t>(std::strtoull(lower.c_str() + pos + 17, nullptr, 10));
+}
+
+size_t countOccurrences(const std::string& haystack, const std::string& needle) {
+    size_t count = 0;
+    for (size_t pos = haystack.find(needle); pos != std::string::npos;
+         pos = haystack.find(needle, pos + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+MockExchange::MockExchange() {
+    listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_fd_ < 0) {
+        throw std::runtime_error("MockExchange: socket() failed");
+    }
+    int enable = 1;
+    ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listen_fd_, 64) != 0) {
+        ::close(listen_fd_);
+        throw std::runtime_error("MockExchange: failed to listen on 127.0.0.1");
+    }
+
+    socklen_t len = sizeof(addr);
+    ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len);
+    port_ = ntohs(addr.sin_port);
+
+    acceptor_ = std::thread(&MockExchange::acceptLoop, this);
+}
+
+MockExchange::~MockExchange() {
+    stopping_ = true;
+    ::shutdown(listen_fd_, SHUT_RDWR);
+    ::close(listen_fd_);
+    if (acceptor_.joinable()) {
+        acceptor_.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int fd : client_fds_) {
+            ::shutdown(fd, SHUT_RDWR);
+        }
+    }
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::string MockExchange::url() const {
+    return "http://127.0.0.1:" + std::to_string(port_);
+}
+
+void MockExchange::acceptLoop() {
+    while (!stopping_) {
+        int fd = ::accept(listen_fd_, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        int enable = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        client_fds_.push_back(fd);
+        workers_.emplace_back(&MockExchange::serve, this, fd);
+    }
+}
+
+void MockExchange::serve(int fd) {
+    std::string buffer;
+    char chunk[16384];
+
+    while (true) {
+        // Complete request (headers + body) in buffer?
+        size_t header_end = buffer.find("\r\n\r\n");
+        if (header_end != std::string::npos) {
+            std::string headers = buffer.substr(0, header_end);
+            size_t body_start = header_end + 4;
+            size_t body_len = contentLength(headers);
+            if (buffer.size() >= body_start + body_len) {
+                size_t path_start = headers.find(' ');
+                size_t path_end = headers.find(' ', path_start + 1);
+                std::string path = path_start == std::string::npos ? "" :
+                    headers.substr(path_start + 1, path_end - path_start - 1);
+                std::string body = buffer.substr(body_start, body_len);
+                buffer.erase(0, body_start + body_len);
+
+                requests_.fetch_add(1, std::memory_order_relaxed);
+                std::string payload = respond(path, body);
+                std::string response = "HTTP/1.1 200 OK\r\n"
+                                       "Content-Type: application/json\r\n"
+                                       "Content-Length: " + std::to_string(payload.size()) +
+                                       "\r\n\r\n" + payload;
+                if (!sendAll(fd, response)) {
+                    break;
+                }
+                continue;
+            }
+        }
+
+        ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        buffer.append(chunk, static_cast<size_t>(n));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    client_fds_.erase(std::remove(client_fds_.begin(), client_fds_.end(), fd), client_fds_.end());
+    ::close(fd);
+}
+
+std::string MockExchange::respond(const std::string& path, const std::string& body) {
+    if (path == "/info") {
+        if (body.find("\"type\":\"spotMeta\"") != std::string::npos) {
+            return SPOT_META_RESPONSE;
+        }
+        if (body.find("\"type\":\"meta\"") != std::string::npos) {
+            return META_RESPONSE;
+        }
+        if (body.find("\"type\":\"allMids\"") != std::string::npos) {
+            return ALL_MIDS_RESPONSE;
+        }
+        return "[]";
+    }
+
+    if (path != "/exchange") {
+        return R"({"status":"err","response":"Unknown path"})";
+    }
+
+    // Every order wire and cancel entry starts with its asset ("a") key
+    size_t entries = countOccurrences(body, "{\"a\":");
+    bool is_cancel = body.find("\"type\":\"cancel\"") != std::string::npos;
+
+    std::string statuses;
+    for (size_t i = 0; i < entries; ++i) {
+        if (i > 0) {
+            statuses += ',';
+        }
+        if (is_cancel) {
+            statuses += "\"success\"";
+        } else {
+            statuses += "{\"resting\":{\"oid\":" + std::to_string(next_oid_.fetch_add(1)) + "}}";
+        }
+    }
+
+    return std::string(R"({"status":"ok","response":{"type":")") +
+           (is_cancel ? "cancel" : "order") +
+           R"(","data":{"statuses":[)" + statuses + "]}}}";
+}
+
+} // namespace bench
+} // namespace hyperliquid
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hyperliquid {
+namespace bench {
+
+/**
+ * In-process HTTP/1.1 stand-in for the /info and /exchange endpoints
+ *
+ * Listens on an ephemeral 127.0.0.1 port with keep-alive connections and
+ * answers with canned data: meta (BTC, ETH, SOL), spotMeta (PURR/USDC),
+ * allMids, and an "ok" order or cancel response with one status per
+ * entry in the action. Requests are never validated or signature-checked.
+ */
+class MockExchange {
+public:
+    MockExchange();
+    ~MockExchange();
+
+    MockExchange(const MockExchange&) = delete;
+    MockExchange& operator=(const MockExchange&) = delete;
+
+    /**
+     * Base URL to pass to Info / Exchange, e.g. "http://127.0.0.1:40123"
+     */
+    std::string url() const;
+
+    uint64_t requestCount() const { return requests_.load(std::memory_order_relaxed); }
+
+private:
+    void acceptLoop();
+    void serve(int fd);
+    std::string respond(const std::string& path, const std::string& body);
+
+    int listen_fd_ = -1;
+    int port_ = 0;
+    std::atomic<bool> stopping_{false};
+    std::atomic<uint64_t> requests_{0};
+    std::atomic<int64_t> next_oid_{1};
+
+    std::thread acceptor_;
+    std::mutex mutex_;
+    std::vector<int> client_fds_;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace bench
+} // namespace hyperliquid
@@ -0,0 +1,456 @@
+/**
+ * End-to-end order latency against an in-process mock exchange
+ *
+ * Drives Exchange::order, bulkOrders, bulkCancel and marketOpen at a fixed
+ * request rate and reports p50/p99/p999 latency:
+ *
+ *   total  - the real Exchange call, measured from its scheduled start so
+ *            queueing behind a slow request is included
+ *   phases - with HYPERLIQUID_ENABLE_LATENCY, the library's own phase
+ *            histograms (latencySnapshot) recorded during those same
+ *            calls, one sample per timed scope. Without instrumentation
+ *            the request is replayed step by step with the public building
+ *            blocks Exchange uses instead: encode (name resolution,
+ *            rounding, wire/action construction), sign (signL1Action),
+ *            serialize (writeExchangePayload), transport (a bare curl POST)
+ *            and parse (typed ack decode)
+ *
+ * Usage: order_latency_bench [--ops N] [--rate PER_SEC] [--batch N]
+ *   --ops    requests per operation (default 1000)
+ *   --rate   requests per second per operation, 0 = back to back (default 500)
+ *   --batch  orders/cancels per bulk request (default 10)
+ */
+
+#include "mock_exchange.hpp"
+#include <hyperliquid/action_response.hpp>
+#include <hyperliquid/exchange.hpp>
+#include <hyperliquid/info.hpp>
+#include <hyperliquid/utils/conversions.hpp>
+#include <hyperliquid/utils/json_writer.hpp>
+#include <hyperliquid/utils/latency.hpp>
+#include <hyperliquid/utils/signing.hpp>
+#include <curl/curl.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace hyperliquid;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+const std::string BENCH_PRIVATE_KEY =
+    "0x0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+
+const char* REPLAY_PHASES[] = {"encode", "sign", "serialize", "transport", "parse"};
+
+struct Options {
+    size_t ops = 1000;
+    double rate = 500.0;
+    size_t batch = 10;
+};
+
+Options parseOptions(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            throw std::invalid_argument("Missing value for " + arg);
+        }
+        const char* value = argv[++i];
+        if (arg == "--ops") {
+            options.ops = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--rate") {
+            options.rate = std::strtod(value, nullptr);
+        } else if (arg == "--batch") {
+            options.batch = std::max<size_t>(1, std::strtoull(value, nullptr, 10));
+        } else {
+            throw std::invalid_argument("Unknown option " + arg);
+        }
+    }
+    return options;
+}
+
+int64_t elapsedNs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+/**
+ * Latency samples for one operation, keyed by phase name
+ */
+class Samples {
+public:
+    void add(const std::string& phase, int64_t ns) { samples_[phase].push_back(ns); }
+
+    double percentileUs(const std::string& phase, double q) {
+        auto& values = samples_[phase];
+        if (values.empty()) {
+            return 0.0;
+        }
+        std::sort(values.begin(), values.end());
+        size_t rank = static_cast<size_t>(std::ceil(q * static_cast<double>(values.size())));
+        size_t index = std::min(values.size() - 1, rank == 0 ? 0 : rank - 1);
+        return static_cast<double>(values[index]) / 1000.0;
+    }
+
+    /**
+     * Library phase histograms recorded during the real calls
+     */
+    void setLibraryPhases(LatencySnapshot snapshot) { library_ = std::move(snapshot); }
+    const std::optional<LatencySnapshot>& libraryPhases() const { return library_; }
+
+private:
+    std::map<std::string, std::vector<int64_t>> samples_;
+    std::optional<LatencySnapshot> library_;
+};
+
+/**
+ * Fixed-rate schedule: request i is due at start + i / rate
+ */
+class Pacer {
+public:
+    explicit Pacer(double rate) : start_(Clock::now()), rate_(rate) {}
+
+    /**
+     * Wait until request i is due and return its scheduled start
+     */
+    Clock::time_point wait(size_t i) {
+        if (rate_ <= 0.0) {
+            return Clock::now();
+        }
+        auto due = start_ + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(static_cast<double>(i) / rate_));
+        std::this_thread::sleep_until(due);
+        return due;
+    }
+
+private:
+    Clock::time_point start_;
+    double rate_;
+};
+
+/**
+ * Bare keep-alive HTTP POST, standing in for API::perform in the staged replay
+ * (only used when the library is built without latency instrumentation)
+ */
+class Transport {
+public:
+    explicit Transport(const std::string& url) : url_(url) {
+        curl_ = curl_easy_init();
+        if (!curl_) {
+            throw std::runtime_error("Failed to initialize libcurl");
+        }
+        headers_ = curl_slist_append(nullptr, "Content-Type: application/json");
+    }
+
+    ~Transport() {
+        curl_slist_free_all(headers_);
+        curl_easy_cleanup(curl_);
+    }
+
+    Transport(const Transport&) = delete;
+    Transport& operator=(const Transport&) = delete;
+
+    const std::string& post(const std::string& body) {
+        response_.clear();
+        curl_easy_setopt(curl_, CURLOPT_URL, url_.c_str());
+        curl_easy_setopt(curl_, CURLOPT_POSTFIELDS, body.c_str());
+        curl_easy_setopt(curl_, CURLOPT_POSTFIELDSIZE, static_cast<long>(body.size()));
+        curl_easy_setopt(curl_, CURLOPT_HTTPHEADER, headers_);
+        curl_easy_setopt(curl_, CURLOPT_WRITEFUNCTION, &Transport::write);
+        curl_easy_setopt(curl_, CURLOPT_WRITEDATA, &response_);
+        CURLcode res = curl_easy_perform(curl_);
+        if (res != CURLE_OK) {
+            throw std::runtime_error(std::string("Transport failed: ") + curl_easy_strerror(res));
+        }
+        return response_;
+    }
+
+private:
+    static size_t write(void* data, size_t size, size_t nmemb, void* userp) {
+        static_cast<std::string*>(userp)->append(static_cast<char*>(data), size * nmemb);
+        return size * nmemb;
+    }
+
+    std::string url_;
+    CURL* curl_ = nullptr;
+    curl_slist* headers_ = nullptr;
+    std::string response_;
+};
+
+/**
+ * Replays Exchange's order and cancel paths one phase at a time
+ */
+class StagedReplay {
+public:
+    StagedReplay(Info& info, const Wallet& wallet, const std::string& base_url)
+        : info_(info), wallet_(wallet), transport_(base_url + "/exchange") {}
+
+    void orders(const std::vector<OrderRequest>& orders, bool market, Samples& samples) {
+        auto t0 = Clock::now();
+        std::vector<OrderWire> wires;
+        wires.reserve(orders.size());
+        for (const auto& order : orders) {
+            int asset = info_.nameToAsset(order.coin);
+            int sz_decimals = info_.asset_to_sz_decimals_.at(asset);
+            bool is_spot = asset >= 10000;
+
+            OrderRequest rounded = order;
+            double px = order.limit_px;
+            if (market) {
+                px = info_.midPrice(order.coin) *
+                     (order.is_buy ? 1.0 + Exchange::DEFAULT_SLIPPAGE : 1.0 - Exchange::DEFAULT_SLIPPAGE);
+            }
+            rounded.limit_px = roundPrice(px, sz_decimals, is_spot);
+            rounded.sz = roundSize(order.sz, sz_decimals);
+            wires.push_back(orderRequestToOrderWire(rounded, asset));
+        }
+        auto action = orderWiresToOrderAction(wires, std::nullopt, "na");
+        send(action, t0, samples);
+    }
+
+    void cancels(const std::vector<CancelRequest>& cancels, Samples& samples) {
+        auto t0 = Clock::now();
+        nlohmann::ordered_json cancels_array = nlohmann::ordered_json::array();
+        for (const auto& cancel : cancels) {
+            nlohmann::ordered_json cancel_obj;
+            cancel_obj["a"] = info_.nameToAsset(cancel.coin);
+            cancel_obj["o"] = cancel.oid;
+            cancels_array.push_back(cancel_obj);
+        }
+        nlohmann::ordered_json action;
+        action["type"] = "cancel";
+        action["cancels"] = cancels_array;
+        send(action, t0, samples);
+    }
+
+private:
+    void send(const nlohmann::ordered_json& action, Clock::time_point t0, Samples& samples) {
+        auto t1 = Clock::now();
+        int64_t nonce = nonce_ = std::max(nonce_ + 1, getTimestampMs());
+        auto signature = signL1Action(wallet_, action, std::nullopt, nonce, std::nullopt, false);
+        auto t2 = Clock::now();
+        writeExchangePayload(body_, action, signature, nonce, true, "", std::nullopt);
+        auto t3 = Clock::now();
+        const std::string& response_body = transport_.post(body_);
+        auto t4 = Clock::now();
+        parseActionResponse(response_body, response_);
+        auto t5 = Clock::now();
+
+        if (!response_.ok) {
+            throw std::runtime_error("Unexpected response: " + response_body);
+        }
+
+        samples.add("encode", elapsedNs(t0, t1));
+        samples.add("sign", elapsedNs(t1, t2));
+        samples.add("serialize", elapsedNs(t2, t3));
+        samples.add("transport", elapsedNs(t3, t4));
+        samples.add("parse", elapsedNs(t4, t5));
+    }
+
+    Info& info_;
+    const Wallet& wallet_;
+    Transport transport_;
+    std::string body_;
+    ActionResponse response_;
+    int64_t nonce_ = 0;
+};
+
+std::vector<OrderRequest> makeOrders(size_t count, size_t seq) {
+    static const char* COINS[] = {"BTC", "ETH", "SOL"};
+    static const double PRICES[] = {43250.5, 2301.25, 98.415};
+
+    std::vector<OrderRequest> orders;
+    orders.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t k = (seq + i) % 3;
+        bool is_buy = ((seq + i) & 1) == 0;
+        OrderRequest order;
+        order.coin = COINS[k];
+        order.is_buy = is_buy;
+        order.sz = 0.01 * static_cast<double>(1 + (seq + i) % 7);
+        // Rest a few ticks away from the mid
+        order.limit_px = PRICES[k] * (is_buy ? 0.99 : 1.01);
+        order.order_type.limit = LimitOrderType{"Gtc"};
+        order.reduce_only = false;
+        orders.push_back(order);
+    }
+    return orders;
+}
+
+void collectOids(const ActionResponse& response, std::vector<int64_t>& oids) {
+    for (const auto& status : response.statuses) {
+        if (const auto* resting = std::get_if<RestingStatus>(&status)) {
+            oids.push_back(resting->oid);
+        }
+    }
+}
+
+std::vector<CancelRequest> takeCancels(std::vector<int64_t>& oids, size_t count, size_t seq) {
+    static const char* COINS[] = {"BTC", "ETH", "SOL"};
+    std::vector<CancelRequest> cancels;
+    for (size_t i = 0; i < count; ++i) {
+        CancelRequest cancel;
+        cancel.coin = COINS[(seq + i) % 3];
+        if (oids.empty()) {
+            cancel.oid = static_cast<int64_t>(seq * count + i + 1);
+        } else {
+            cancel.oid = oids.back();
+            oids.pop_back();
+        }
+        cancels.push_back(cancel);
+    }
+    return cancels;
+}
+
+/**
+ * Run one operation through the real Exchange (total); phases come from the
+ * library's histograms for those calls, or from the staged replay
+ */
+void runOperation(const Options& options,
+                  Samples& samples,
+                  const std::function<void(size_t)>& real,
+                  const std::function<void(size_t)>& staged) {
+    resetLatency();
+    Pacer real_pacer(options.rate);
+    for (size_t i = 0; i < options.ops; ++i) {
+        auto scheduled = real_pacer.wait(i);
+        real(i);
+        samples.add("total", elapsedNs(scheduled, Clock::now()));
+    }
+
+    if (latencyEnabled()) {
+        samples.setLibraryPhases(latencySnapshot());
+        return;
+    }
+
+    Pacer staged_pacer(options.rate);
+    for (size_t i = 0; i < options.ops; ++i) {
+        staged_pacer.wait(i);
+        staged(i);
+    }
+}
+
+void report(const std::string& name, Samples& samples) {
+    if (samples.libraryPhases().has_value()) {
+        const LatencySnapshot& snapshot = *samples.libraryPhases();
+        for (size_t i = 0; i < LATENCY_PHASE_COUNT; ++i) {
+            const auto& histogram = snapshot.phases[i];
+            if (histogram.count() == 0) {
+                continue;
+            }
+            std::printf("%-12s %-16s %10.1f %10.1f %10.1f\n", name.c_str(),
+                        latencyPhaseName(static_cast<LatencyPhase>(i)),
+                        static_cast<double>(histogram.percentile(0.50)) / 1000.0,
+                        static_cast<double>(histogram.percentile(0.99)) / 1000.0,
+                        static_cast<double>(histogram.percentile(0.999)) / 1000.0);
+        }
+    } else {
+        for (const char* phase : REPLAY_PHASES) {
+            std::printf("%-12s %-16s %10.1f %10.1f %10.1f\n", name.c_str(), phase,
+                        samples.percentileUs(phase, 0.50),
+                        samples.percentileUs(phase, 0.99),
+                        samples.percentileUs(phase, 0.999));
+        }
+    }
+    std::printf("%-12s %-16s %10.1f %10.1f %10.1f\n", name.c_str(), "total",
+                samples.percentileUs("total", 0.50),
+                samples.percentileUs("total", 0.99),
+                samples.percentileUs("total", 0.999));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    try {
+        Options options = parseOptions(argc, argv);
+
+        curl_global_init(CURL_GLOBAL_DEFAULT);
+        bench::MockExchange mock;
+
+        auto wallet = Wallet::fromPrivateKey(BENCH_PRIVATE_KEY);
+        Exchange exchange(wallet, mock.url());
+        Info info(mock.url(), true);
+
+        // Measure the stack itself, not client-side throttling
+        exchange.setRateLimiter(nullptr);
+        info.setRateLimiter(nullptr);
+        StagedReplay staged(info, *wallet, mock.url());
+
+        std::printf("phases: %s\n", latencyEnabled() ? "library instrumentation (per timed scope)"
+                                                      : "staged replay (library built without instrumentation)");
+        std::printf("%-12s %-16s %10s %10s %10s\n", "operation", "phase", "p50_us", "p99_us", "p999_us");
+
+        std::vector<int64_t> resting;
+        ActionResponse response;
+        OrderType gtc;
+        gtc.limit = LimitOrderType{"Gtc"};
+
+        Samples order_samples;
+        runOperation(options, order_samples,
+            [&](size_t i) {
+                const auto order = makeOrders(1, i).front();
+                exchange.order(order.coin, order.is_buy, order.sz, order.limit_px, gtc);
+            },
+            [&](size_t i) { staged.orders(makeOrders(1, i), false, order_samples); });
+        report("order", order_samples);
+
+        Samples bulk_samples;
+        runOperation(options, bulk_samples,
+            [&](size_t i) {
+                exchange.bulkOrders(makeOrders(options.batch, i), response);
+                collectOids(response, resting);
+            },
+            [&](size_t i) { staged.orders(makeOrders(options.batch, i), false, bulk_samples); });
+        report("bulkOrders", bulk_samples);
+
+        // Cancel the orders placed above; the replay cancels synthetic oids
+        Samples cancel_samples;
+        std::vector<int64_t> synthetic;
+        runOperation(options, cancel_samples,
+            [&](size_t i) { exchange.bulkCancel(takeCancels(resting, options.batch, i), response); },
+            [&](size_t i) { staged.cancels(takeCancels(synthetic, options.batch, i), cancel_samples); });
+        report("bulkCancel", cancel_samples);
+
+        Samples market_samples;
+        runOperation(options, market_samples,
+            [&](size_t i) {
+                const auto order = makeOrders(1, i).front();
+                exchange.marketOpen(order.coin, order.is_buy, order.sz);
+            },
+            [&](size_t i) { staged.orders(makeOrders(1, i), true, market_samples); });
+        report("marketOpen", market_samples);
+
+        std::printf("\nrequests served by mock: %llu\n",
+                    static_cast<unsigned long long>(mock.requestCount()));
+
+        // Transfer timings reported by curl for the Exchange under test
+        std::printf("\n%-10s %-10s %8s %8s %10s %10s %10s\n",
+                    "endpoint", "type", "count", "reused", "server_us", "ttfb_us", "total_us");
+        for (const auto& summary : exchange.transferStats()->snapshot()) {
+            std::printf("%-10s %-10s %8llu %8llu %10.1f %10.1f %10.1f\n",
+                        summary.endpoint.c_str(), summary.type.c_str(),
+                        static_cast<unsigned long long>(summary.count),
+                        static_cast<unsigned long long>(summary.reused),
+                        summary.server.mean() / 1000.0,
+                        summary.ttfb.mean() / 1000.0,
+                        summary.total.mean() / 1000.0);
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "order_latency_bench: %s\n", e.what());
+        return 1;
+    }
+
+    curl_global_cleanup();
+    return 0;
+}
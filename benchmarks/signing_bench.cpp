@@ -0,0 +1,323 @@
+/**
+ * Microbenchmarks for the order encoding, signing and ack decoding hot path
+ *
+ * Each benchmark processes a batch of 1, 10 or 100 items per iteration and
+ * reports items/second. Results are printed as JSON unless another
+ * --benchmark_format is given, e.g.
+ *
+ *   ./hyperliquid_bench --benchmark_out=bench.json
+ */
+
+#include <hyperliquid/action_response.hpp>
+#include <hyperliquid/utils/conversions.hpp>
+#include <hyperliquid/utils/signing.hpp>
+#include <benchmark/benchmark.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+namespace crypto {
+    std::vector<uint8_t> keccak256(const std::vector<uint8_t>& data);
+    void* createKeyFromPrivate(const std::string& private_key_hex);
+    Signature signHash(const void* ec_key, const std::vector<uint8_t>& hash);
+    void freeKey(void* ec_key);
+    std::vector<uint8_t> encodeTypedData(const nlohmann::json& typed_data);
+    int calculateRecoveryId(const EC_KEY* ec_key,
+                            const std::vector<uint8_t>& hash,
+                            const ECDSA_SIG* sig);
+}
+}
+
+using namespace hyperliquid;
+
+namespace {
+
+const std::string BENCH_PRIVATE_KEY =
+    "0x0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+
+/**
+ * Deterministic inputs so runs are comparable across commits
+ */
+std::vector<double> makePrices(size_t count) {
+    std::vector<double> prices;
+    prices.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        prices.push_back(43250.123456 + static_cast<double>(i) * 0.731);
+    }
+    return prices;
+}
+
+std::vector<OrderRequest> makeOrders(size_t count) {
+    std::vector<OrderRequest> orders;
+    orders.reserve(count);
+    auto prices = makePrices(count);
+    for (size_t i = 0; i < count; ++i) {
+        OrderRequest order;
+        order.coin = "BTC";
+        order.is_buy = (i % 2) == 0;
+        order.sz = roundSize(0.001 * static_cast<double>(i + 1), 5);
+        order.limit_px = roundPrice(prices[i], 5, false);
+        order.order_type.limit = LimitOrderType{"Gtc"};
+        order.reduce_only = false;
+        orders.push_back(order);
+    }
+    return orders;
+}
+
+std::vector<OrderWire> makeWires(size_t count) {
+    std::vector<OrderWire> wires;
+    wires.reserve(count);
+    for (const auto& order : makeOrders(count)) {
+        wires.push_back(orderRequestToOrderWire(order, 0));
+    }
+    return wires;
+}
+
+std::vector<std::vector<uint8_t>> makeHashes(size_t count) {
+    std::vector<std::vector<uint8_t>> hashes;
+    hashes.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t value = i;
+        std::vector<uint8_t> seed(sizeof(value));
+        std::memcpy(seed.data(), &value, sizeof(value));
+        hashes.push_back(crypto::keccak256(seed));
+    }
+    return hashes;
+}
+
+/**
+ * EIP-712 payloads for single-order L1 actions, as signL1Action builds them
+ */
+std::vector<nlohmann::json> makeTypedData(size_t count) {
+    std::vector<nlohmann::json> payloads;
+    auto wires = makeWires(count);
+    payloads.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto action = orderWiresToOrderAction({wires[i]}, std::nullopt, "na");
+        auto hash = actionHash(action, std::nullopt, 1700000000000 + static_cast<int64_t>(i), std::nullopt);
+        payloads.push_back(l1Payload(constructPhantomAgent(hash, true)));
+    }
+    return payloads;
+}
+
+/**
+ * Order ack with alternating resting and filled statuses
+ */
+std::string makeOrderResponse(size_t count) {
+    std::string body = R"({"status":"ok","response":{"type":"order","data":{"statuses":[)";
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            body += ',';
+        }
+        std::string oid = std::to_string(77738308 + i);
+        if (i % 2 == 0) {
+            body += R"({"resting":{"oid":)" + oid + "}}";
+        } else {
+            body += R"({"filled":{"totalSz":"0.02","avgPx":"1891.4","oid":)" + oid + "}}";
+        }
+    }
+    body += "]}}}";
+    return body;
+}
+
+void finishBatch(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+static void BM_FloatToWire(benchmark::State& state) {
+    // floatToWire rejects values that need rounding, so feed it tick-aligned prices
+    auto prices = makePrices(static_cast<size_t>(state.range(0)));
+    for (double& price : prices) {
+        price = roundPrice(price, 5, false);
+    }
+    for (auto _ : state) {
+        for (double price : prices) {
+            benchmark::DoNotOptimize(floatToWire(price));
+        }
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_FloatToWire)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_RoundPrice(benchmark::State& state) {
+    auto prices = makePrices(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (double price : prices) {
+            benchmark::DoNotOptimize(roundPrice(price, 5, false));
+        }
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_RoundPrice)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_OrderRequestToOrderWire(benchmark::State& state) {
+    auto orders = makeOrders(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& order : orders) {
+            benchmark::DoNotOptimize(orderRequestToOrderWire(order, 0));
+        }
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_OrderRequestToOrderWire)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_OrderWiresToOrderAction(benchmark::State& state) {
+    auto wires = makeWires(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(orderWiresToOrderAction(wires, std::nullopt, "na"));
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_OrderWiresToOrderAction)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_ActionHash(benchmark::State& state) {
+    auto action = orderWiresToOrderAction(makeWires(static_cast<size_t>(state.range(0))),
+                                          std::nullopt, "na");
+    int64_t nonce = 1700000000000;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(actionHash(action, std::nullopt, nonce++, std::nullopt));
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_ActionHash)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_EncodeTypedData(benchmark::State& state) {
+    auto payloads = makeTypedData(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& payload : payloads) {
+            benchmark::DoNotOptimize(crypto::encodeTypedData(payload));
+        }
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_EncodeTypedData)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_Keccak256(benchmark::State& state) {
+    // One msgpack-encoded order action per item
+    std::string packed = packAction(orderWiresToOrderAction(makeWires(1), std::nullopt, "na"));
+    std::vector<uint8_t> input(packed.begin(), packed.end());
+    const auto count = state.range(0);
+    for (auto _ : state) {
+        for (int64_t i = 0; i < count; ++i) {
+            benchmark::DoNotOptimize(crypto::keccak256(input));
+        }
+    }
+    finishBatch(state);
+    state.SetBytesProcessed(state.iterations() * count * static_cast<int64_t>(input.size()));
+}
+BENCHMARK(BM_Keccak256)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_SignHash(benchmark::State& state) {
+    void* key = crypto::createKeyFromPrivate(BENCH_PRIVATE_KEY);
+    auto hashes = makeHashes(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (const auto& hash : hashes) {
+            benchmark::DoNotOptimize(crypto::signHash(key, hash));
+        }
+    }
+    crypto::freeKey(key);
+    finishBatch(state);
+}
+BENCHMARK(BM_SignHash)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_CalculateRecoveryId(benchmark::State& state) {
+    void* key = crypto::createKeyFromPrivate(BENCH_PRIVATE_KEY);
+    auto hashes = makeHashes(static_cast<size_t>(state.range(0)));
+
+    // Rebuild the ECDSA_SIG from signHash's output, outside the timed loop
+    std::vector<ECDSA_SIG*> sigs;
+    for (const auto& hash : hashes) {
+        Signature signature = crypto::signHash(key, hash);
+        BIGNUM* r = nullptr;
+        BIGNUM* s = nullptr;
+        BN_hex2bn(&r, signature.r.c_str() + 2);
+        BN_hex2bn(&s, signature.s.c_str() + 2);
+        ECDSA_SIG* sig = ECDSA_SIG_new();
+        ECDSA_SIG_set0(sig, r, s);
+        sigs.push_back(sig);
+    }
+
+    const EC_KEY* ec_key = static_cast<const EC_KEY*>(key);
+    for (auto _ : state) {
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            benchmark::DoNotOptimize(crypto::calculateRecoveryId(ec_key, hashes[i], sigs[i]));
+        }
+    }
+
+    for (ECDSA_SIG* sig : sigs) {
+        ECDSA_SIG_free(sig);
+    }
+    crypto::freeKey(key);
+    finishBatch(state);
+}
+BENCHMARK(BM_CalculateRecoveryId)->Arg(1)->Arg(10)->Arg(100);
+
+static void BM_ParseActionResponse(benchmark::State& state) {
+    std::string body = makeOrderResponse(static_cast<size_t>(state.range(0)));
+    ActionResponse response;
+    for (auto _ : state) {
+        parseActionResponse(body, response);
+        benchmark::DoNotOptimize(response.statuses.data());
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_ParseActionResponse)->Arg(1)->Arg(10)->Arg(100);
+
+// Baseline: DOM parse plus the per-status lookups callers used to do
+static void BM_ParseActionResponseJson(benchmark::State& state) {
+    std::string body = makeOrderResponse(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto response = nlohmann::json::parse(body);
+        int64_t sum = 0;
+        for (const auto& status : response["response"]["data"]["statuses"]) {
+            if (status.contains("resting")) {
+                sum += status["resting"]["oid"].get<int64_t>();
+            } else if (status.contains("filled")) {
+                sum += decimalToFixed(status["filled"]["totalSz"].get_ref<const std::string&>());
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    finishBatch(state);
+}
+BENCHMARK(BM_ParseActionResponseJson)->Arg(1)->Arg(10)->Arg(100);
+
+int main(int argc, char** argv) {
+    // Fail before any output rather than aborting halfway through the JSON
+    try {
+        crypto::keccak256(std::vector<uint8_t>{});
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "hyperliquid_bench: %s\n", e.what());
+        return 1;
+    }
+
+    // Default to JSON so results can be archived and diffed per commit
+    std::vector<char*> args(argv, argv + argc);
+    bool has_format = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--benchmark_format", 18) == 0) {
+            has_format = true;
+        }
+    }
+    std::string json_format = "--benchmark_format=json";
+    if (!has_format) {
+        args.push_back(json_format.data());
+    }
+
+    int args_count = static_cast<int>(args.size());
+    benchmark::Initialize(&args_count, args.data());
+    if (benchmark::ReportUnrecognizedArguments(args_count, args.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "hyperliquid/clearinghouse.hpp"
+#include "hyperliquid/types.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * One resting order from openOrders; prices and sizes in fixed point
+ */
+struct OpenOrder {
+    int asset = -1;  // -1 when the coin is not in the caller's metadata
+    int64_t oid = 0;
+    std::optional<Cloid> cloid;
+    bool is_buy = false;
+    int64_t limit_px = 0;
+    int64_t sz = 0;       // remaining size
+    int64_t orig_sz = 0;
+    int64_t timestamp = 0;
+};
+
+/**
+ * One token balance from spotClearinghouseState; amounts in fixed point
+ * token is the index into SpotMeta::tokens
+ */
+struct SpotBalance {
+    int token = -1;
+    int64_t total = 0;
+    int64_t hold = 0;
+    int64_t entry_ntl = 0;
+};
+
+/**
+ * Queries to run for one account in Info::accountSnapshots()
+ */
+struct AccountRequest {
+    std::string user;
+    std::string dex;            // perp dex for userState and openOrders
+    bool user_state = true;     // clearinghouseState
+    bool open_orders = true;
+    bool spot_state = false;    // spotClearinghouseState
+};
+
+/**
+ * Typed results for one AccountRequest; parts that were not requested
+ * are left empty
+ */
+struct AccountSnapshot {
+    ClearinghouseState state;
+    std::vector<OpenOrder> open_orders;
+    std::vector<SpotBalance> spot_balances;
+
+    /**
+     * Reset for reuse, keeping allocated capacity
+     */
+    void clear();
+};
+
+/**
+ * Decode an openOrders body into orders, reusing its storage; orders on
+ * coins missing from coin_to_asset are kept with asset -1.
+ * Throws on malformed JSON.
+ */
+void parseOpenOrders(std::string_view body,
+                     const std::unordered_map<std::string, int>& coin_to_asset,
+                     std::vector<OpenOrder>& orders);
+
+/**
+ * Decode a spotClearinghouseState body into balances, reusing its storage
+ * Throws on malformed JSON.
+ */
+void parseSpotBalances(std::string_view body, std::vector<SpotBalance>& balances);
+
+} // namespace hyperliquid
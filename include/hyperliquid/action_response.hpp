@@ -0,0 +1,82 @@
+#pragma once
+
+#include "hyperliquid/types.hpp"
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * Order accepted and resting on the book
+ */
+struct RestingStatus {
+    int64_t oid = 0;
+    std::optional<Cloid> cloid;
+};
+
+/**
+ * Order filled on arrival; total_sz and avg_px in fixed point (FIXED_POINT_SCALE)
+ */
+struct FilledStatus {
+    int64_t total_sz = 0;
+    int64_t avg_px = 0;
+    int64_t oid = 0;
+    std::optional<Cloid> cloid;
+};
+
+/**
+ * Item rejected by the exchange
+ */
+struct ErrorStatus {
+    std::string message;
+};
+
+/**
+ * Bare string status: "success" for cancels and modifies,
+ * "waitingForFill" / "waitingForTrigger" for grouped TP/SL orders
+ */
+struct AckStatus {
+    std::string status;
+};
+
+/**
+ * Outcome of one order, cancel or modify in an action
+ */
+using OrderStatus = std::variant<RestingStatus, FilledStatus, ErrorStatus, AckStatus>;
+
+/**
+ * Decoded /exchange response
+ *
+ * ok is false when the whole action was rejected ("status": "err"), in
+ * which case error holds the reason and statuses is empty. Otherwise
+ * statuses is index-aligned with the submitted orders/cancels/modifies.
+ */
+struct ActionResponse {
+    bool ok = false;
+    std::string type;   // "order", "cancel", "batchModify", "default", ...
+    std::string error;
+    std::vector<OrderStatus> statuses;
+
+    /**
+     * Reset for reuse, keeping allocated capacity
+     */
+    void clear();
+};
+
+/**
+ * Decode an /exchange response body in a single SAX pass into result,
+ * reusing its storage; throws on malformed JSON
+ */
+void parseActionResponse(std::string_view body, ActionResponse& result);
+
+/**
+ * Decode an already parsed /exchange response into result, for callers
+ * that keep the document; same result as parseActionResponse
+ */
+void actionResponseFromJson(const nlohmann::json& body, ActionResponse& result);
+
+} // namespace hyperliquid
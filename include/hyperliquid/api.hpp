@@ -1,18 +1,86 @@
 #pragma once
 
+#include "hyperliquid/rate_limiter.hpp"
+#include "hyperliquid/transfer_stats.hpp"
+#include <chrono>
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
 #include <nlohmann/json.hpp>
 
 namespace hyperliquid {
 
+/**
+ * Retries and hedging for /info queries
+ *
+ * Only idempotent /info requests are retried or hedged; signed /exchange
+ * actions are always sent exactly once. Retries follow 5xx responses and
+ * transient transport failures after a full-jitter exponential backoff.
+ * A hedge duplicates a query that has not answered within the hedge
+ * quantile of its past latency on a second pooled connection, and the
+ * first answer wins. The client timeout bounds a query's attempts and
+ * backoffs together.
+ *
+ * Streamed queries are only retried while none of the body has reached
+ * the callback, and a hedged stream goes to the first request to start
+ * its body. Batched queries hedge into connection slots left idle at the
+ * tail of the batch.
+ */
+struct RetryPolicy {
+    int max_attempts = 3;                          // 1 disables retries
+    std::chrono::milliseconds base_backoff{50};
+    std::chrono::milliseconds max_backoff{2000};
+    int attempt_timeout_ms = 10000;                // per-attempt timeout; 0 uses the client timeout
+    bool hedge = false;
+    double hedge_quantile = 0.95;
+    uint64_t hedge_min_samples = 20;               // below this, hedge_default_delay is used
+    std::chrono::milliseconds hedge_default_delay{250};
+    std::chrono::milliseconds hedge_min_delay{5};
+};
+
 /**
  * Base API client for HTTP communication with Hyperliquid
  */
 class API {
 public:
+    static constexpr size_t DEFAULT_MAX_IN_FLIGHT = 8;  // concurrent transfers for batched queries
+
     explicit API(const std::string& base_url = "", int timeout_ms = 30000);
     virtual ~API();
 
+    /**
+     * Timing of the most recent completed transfer on the main connection
+     */
+    const TransferTiming& lastTransfer() const { return last_transfer_; }
+
+    /**
+     * Transfer timings aggregated per endpoint and request type
+     */
+    std::shared_ptr<TransferStats> transferStats() const { return transfer_stats_; }
+
+    /**
+     * Record into a shared stats object instead, e.g. one for several clients
+     */
+    virtual void setTransferStats(std::shared_ptr<TransferStats> stats);
+
+    /**
+     * Limiter every request waits on; null when rate limiting is off
+     */
+    std::shared_ptr<RateLimiter> rateLimiter() const { return rate_limiter_; }
+
+    /**
+     * Share a limiter between clients on the same IP, or pass null to disable
+     */
+    virtual void setRateLimiter(std::shared_ptr<RateLimiter> limiter);
+
+    const RetryPolicy& retryPolicy() const { return retry_policy_; }
+
+    /**
+     * Change how /info queries are retried and hedged
+     */
+    virtual void setRetryPolicy(const RetryPolicy& policy);
+
 protected:
     /**
      * POST request to API endpoint
@@ -20,6 +88,61 @@ protected:
     nlohmann::json post(const std::string& url_path,
                        const nlohmann::json& payload = nlohmann::json::object());
 
+    /**
+     * POST an already-serialized JSON body to API endpoint; request_type
+     * labels the transfer in transferStats() and, with batch_length (the
+     * number of orders/cancels in an action), sets its rate limit weight
+     */
+    nlohmann::json postBody(const std::string& url_path,
+                            const std::string& body,
+                            const std::string& request_type = "",
+                            size_t batch_length = 0);
+
+    /**
+     * postBody() without parsing: the checked response body is left in
+     * response_body, whose storage is reused
+     */
+    void postBodyRaw(const std::string& url_path,
+                     const std::string& body,
+                     const std::string& request_type,
+                     size_t batch_length,
+                     std::string& response_body);
+
+    /**
+     * Parse a response body into a JSON document
+     */
+    static nlohmann::json parseBody(const std::string& response_body);
+
+    /**
+     * POST request whose response body is handed to on_data chunk by chunk
+     * as it arrives instead of being buffered and parsed; /info queries
+     * are retried and hedged under the retry policy
+     */
+    using ChunkCallback = std::function<void(const char* data, size_t len)>;
+    void postStream(const std::string& url_path,
+                    const nlohmann::json& payload,
+                    const ChunkCallback& on_data);
+
+    /**
+     * POST several payloads to one endpoint concurrently, keeping at most
+     * max_in_flight transfers open; response bodies are handed to
+     * on_data(index, ...) as they arrive. /info queries are retried and
+     * hedged under the retry policy. Throws the first failure after all
+     * transfers have finished.
+     */
+    using IndexedChunkCallback = std::function<void(size_t index, const char* data, size_t len)>;
+    void postManyStream(const std::string& url_path,
+                        const std::vector<nlohmann::json>& payloads,
+                        const IndexedChunkCallback& on_data,
+                        size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
+    /**
+     * Buffered form of postManyStream(); results are in payload order
+     */
+    std::vector<nlohmann::json> postMany(const std::string& url_path,
+                                         const std::vector<nlohmann::json>& payloads,
+                                         size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
     std::string base_url_;
     int timeout_ms_;
 
@@ -28,9 +151,86 @@ private:
     void cleanupCurl();
     void handleException(long response_code, const std::string& response_body);
 
+    void configureRequest(void* curl,
+                          const std::string& url,
+                          const std::string& body,
+                          void* headers,
+                          size_t (*write_fn)(void*, size_t, size_t, void*),
+                          void* write_data,
+                          int timeout_ms);
+
+    long perform(const std::string& url_path,
+                 const std::string& body,
+                 const std::string& request_type,
+                 size_t batch_length,
+                 size_t (*write_fn)(void*, size_t, size_t, void*),
+                 void* write_data,
+                 int timeout_ms = 0);
+
+    /**
+     * One attempt on the main connection whose 2xx body goes to on_data;
+     * delivered is set once any of it has
+     */
+    long performStream(const std::string& url_path,
+                       const std::string& body,
+                       const std::string& request_type,
+                       int timeout_ms,
+                       const ChunkCallback& on_data,
+                       std::string& error_body,
+                       bool& delivered);
+
+    /**
+     * perform() under the retry policy; the last attempt's status and
+     * body are returned. With on_data a 2xx body is streamed to it and
+     * only an error body is left in response_body.
+     */
+    long performIdempotent(const std::string& url_path,
+                           const std::string& body,
+                           const std::string& request_type,
+                           std::string& response_body,
+                           const ChunkCallback* on_data = nullptr);
+
+    /**
+     * One attempt that is duplicated on a second connection if it has
+     * not answered within the hedge delay; delivered is set once any of
+     * a streamed body has reached on_data
+     */
+    long performHedged(const std::string& url_path,
+                       const std::string& body,
+                       const std::string& request_type,
+                       std::string& response_body,
+                       int timeout_ms,
+                       const ChunkCallback* on_data,
+                       bool& delivered);
+
+    void* multiHandle();
+
+    void acquireWeight(const std::string& url_path,
+                       const std::string& request_type,
+                       size_t batch_length);
+    void updateRateLimit(void* curl, long response_code);
+
+    /**
+     * Record a finished transfer; a hedge passes how long after the original
+     * request it was launched so its ttfb and total count from that start
+     */
+    void recordTransfer(void* curl,
+                        const std::string& url_path,
+                        const std::string& request_type,
+                        TransferTiming* last,
+                        int64_t start_offset_us = 0);
+
     static size_t writeCallback(void* contents, size_t size, size_t nmemb, void* userp);
+    static size_t streamCallback(void* contents, size_t size, size_t nmemb, void* userp);
+
+    void* curl_handle_;   // CURL* hidden in implementation
+    void* multi_handle_;  // CURLM* for postMany and hedging, created on first use
+    void* hedge_handles_[2];  // CURL* pair for hedged queries, created on first use
 
-    void* curl_handle_;  // CURL* hidden in implementation
+    TransferTiming last_transfer_;
+    std::shared_ptr<TransferStats> transfer_stats_;
+    std::shared_ptr<RateLimiter> rate_limiter_;
+    RetryPolicy retry_policy_;
 };
 
 } // namespace hyperliquid
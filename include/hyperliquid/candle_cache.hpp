@@ -0,0 +1,57 @@
+#pragma once
+
+#include "hyperliquid/candles.hpp"
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+
+class Info;
+
+/**
+ * On-disk candle cache, one file per coin and interval
+ *
+ * Each file holds the closed candles for a contiguous covered range of
+ * open times. A load fetches only the parts of the requested range that
+ * fall outside that coverage (in chunks of at most 5000 candles, all
+ * coins concurrently), merges them in and rewrites the file. Candles that
+ * are still forming are returned but never persisted. Not thread-safe.
+ */
+class CandleCache {
+public:
+    static constexpr int64_t MAX_CANDLES_PER_REQUEST = 5000;
+
+    CandleCache(Info& info, const std::string& directory);
+
+    /**
+     * Candles with open time in [start_time, end_time]
+     */
+    Candles load(const std::string& name,
+                 const std::string& interval,
+                 int64_t start_time,
+                 int64_t end_time);
+
+    /**
+     * Same for several coins at once; results are in names order
+     */
+    std::vector<Candles> loadMany(const std::vector<std::string>& names,
+                                  const std::string& interval,
+                                  int64_t start_time,
+                                  int64_t end_time);
+
+private:
+    struct Entry {
+        int64_t covered_start = 0;
+        int64_t covered_end = -1;  // empty when covered_end < covered_start
+        Candles candles;
+    };
+
+    std::string pathFor(const std::string& coin, const std::string& interval) const;
+    bool read(const std::string& path, Entry& entry) const;
+    void write(const std::string& path, const Entry& entry) const;
+
+    Info& info_;
+    std::string directory_;
+};
+
+} // namespace hyperliquid
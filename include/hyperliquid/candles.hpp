@@ -0,0 +1,70 @@
+#pragma once
+
+#include "hyperliquid/utils/json_stream.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * OHLCV candles in columnar form (one array per field, index-aligned)
+ */
+struct Candles {
+    std::vector<int64_t> time;  // open time (ms)
+    std::vector<double> open;
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+    std::vector<double> volume;
+    std::vector<int64_t> trades;
+
+    size_t size() const { return time.size(); }
+    bool empty() const { return time.empty(); }
+    void reserve(size_t n);
+    void clear();
+
+    /**
+     * Append row i of other
+     */
+    void append(const Candles& other, size_t i);
+};
+
+/**
+ * One candleSnapshot query
+ */
+struct CandleRequest {
+    std::string coin;
+    std::string interval;  // "1m", "15m", "1h", "1d", ...
+    int64_t start_time = 0;
+    int64_t end_time = 0;
+};
+
+/**
+ * Length of a candle interval in ms ("1M" counts as 31 days)
+ */
+int64_t candleIntervalMs(const std::string& interval);
+
+/**
+ * Incremental parser for a candleSnapshot response body
+ *
+ * Appends each candle to the output columns as its bytes arrive.
+ */
+class CandleParser {
+public:
+    explicit CandleParser(Candles& out);
+
+    CandleParser(const CandleParser&) = delete;
+    CandleParser& operator=(const CandleParser&) = delete;
+
+    void feed(const char* data, size_t len);
+    void finish();
+
+private:
+    void emitCandle(std::string_view object);
+
+    Candles& out_;
+    ObjectArrayStream stream_;
+};
+
+} // namespace hyperliquid
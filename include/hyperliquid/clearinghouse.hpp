@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * Account-level margin totals, in fixed point (FIXED_POINT_SCALE)
+ */
+struct MarginSummary {
+    int64_t account_value = 0;
+    int64_t total_margin_used = 0;
+    int64_t total_ntl_pos = 0;
+    int64_t total_raw_usd = 0;
+};
+
+/**
+ * One perp position from clearinghouseState; amounts in fixed point
+ */
+struct AssetPosition {
+    int asset = -1;  // -1 for a slot without a position
+    int64_t szi = 0;  // signed size: positive long, negative short
+    int64_t entry_px = 0;
+    int64_t position_value = 0;
+    int64_t unrealized_pnl = 0;
+    int64_t return_on_equity = 0;
+    int64_t liquidation_px = 0;  // 0 when the exchange reports none
+    int64_t margin_used = 0;
+    int64_t cum_funding_all_time = 0;
+    int64_t cum_funding_since_open = 0;
+    int64_t cum_funding_since_change = 0;
+    int leverage = 0;
+    bool is_cross = true;
+    int max_leverage = 0;
+
+    bool active() const { return asset >= 0; }
+};
+
+/**
+ * Typed clearinghouseState (userState) snapshot
+ *
+ * Positions live in a dense array indexed by asset id within the
+ * snapshot's dex (asset % PERP_DEX_STRIDE); active lists the asset ids
+ * that hold a position, in response order. Refilling an instance only
+ * resets the slots that were active, so polling into the same instance
+ * does not allocate once the array has grown to the highest asset seen.
+ */
+struct ClearinghouseState {
+    // Asset ids of builder-deployed dexes start every 10000 ids (110000, 120000, ...)
+    static constexpr int PERP_DEX_STRIDE = 10000;
+
+    MarginSummary margin_summary;
+    MarginSummary cross_margin_summary;
+    int64_t cross_maintenance_margin_used = 0;
+    int64_t withdrawable = 0;
+    int64_t time = 0;
+
+    int asset_offset = 0;  // asset id of positions[0]
+    std::vector<AssetPosition> positions;
+    std::vector<int> active;
+
+    /**
+     * Position for an asset id, or nullptr if there is none
+     */
+    const AssetPosition* position(int asset) const;
+
+    /**
+     * Reset for reuse, keeping allocated capacity
+     */
+    void clear();
+};
+
+/**
+ * Decode a clearinghouseState body in a single SAX pass into state,
+ * reusing its storage; coins missing from coin_to_asset are skipped.
+ * Throws on malformed JSON.
+ */
+void parseClearinghouseState(std::string_view body,
+                             const std::unordered_map<std::string, int>& coin_to_asset,
+                             ClearinghouseState& state);
+
+} // namespace hyperliquid
@@ -37,6 +37,17 @@ private:
     std::string error_data_;
 };
 
+/**
+ * Rate limit exceeded (HTTP 429); the client's RateLimiter backs off
+ */
+class RateLimitError : public ClientError {
+public:
+    RateLimitError(const std::string& error_code,
+                   const std::string& error_message,
+                   const std::string& error_data = "")
+        : ClientError(429, error_code, error_message, error_data) {}
+};
+
 /**
  * Server error (5xx HTTP status codes)
  */
@@ -51,4 +62,19 @@ private:
     int status_code_;
 };
 
+/**
+ * Transfer that failed before an HTTP response arrived; transient
+ * failures (timeouts, refused or reset connections) may be retried
+ */
+class NetworkError : public Error {
+public:
+    NetworkError(const std::string& message, bool transient)
+        : Error(message), transient_(transient) {}
+
+    bool transient() const { return transient_; }
+
+private:
+    bool transient_;
+};
+
 } // namespace hyperliquid
@@ -1,8 +1,13 @@
 #pragma once
 
+#include "hyperliquid/action_response.hpp"
 #include "hyperliquid/api.hpp"
 #include "hyperliquid/info.hpp"
+#include "hyperliquid/order_manager.hpp"
+#include "hyperliquid/positions.hpp"
+#include "hyperliquid/quote_slot.hpp"
 #include "hyperliquid/types.hpp"
+#include "hyperliquid/utils/nonce.hpp"
 #include "hyperliquid/utils/signing.hpp"
 #include <memory>
 #include <vector>
@@ -10,6 +15,19 @@
 
 namespace hyperliquid {
 
+/**
+ * Order action that has been rounded, encoded and signed but not yet sent
+ */
+struct PreparedAction {
+    nlohmann::ordered_json action;
+    Signature signature;
+    int64_t nonce = 0;
+    std::vector<OrderRequest> orders;  // rounded orders, for local tracking
+    std::vector<int> assets;
+    std::string vault_address;              // target it was signed for ("" for the wallet)
+    std::optional<int64_t> expires_after;   // as signed; sent with the action
+};
+
 /**
  * Exchange class for trading operations
  */
@@ -45,6 +63,29 @@ public:
                              const std::optional<BuilderInfo>& builder = std::nullopt,
                              const std::string& grouping = "na");
 
+    /**
+     * Place multiple orders, decoding the response straight into result
+     * (reused across calls) instead of building a JSON document
+     */
+    void bulkOrders(const std::vector<OrderRequest>& orders,
+                    ActionResponse& result,
+                    const std::optional<BuilderInfo>& builder = std::nullopt,
+                    const std::string& grouping = "na");
+
+    /**
+     * Round, encode and sign an order action without sending it
+     * Safe to call from one thread while another thread is sending.
+     */
+    PreparedAction prepareOrders(const std::vector<OrderRequest>& orders,
+                                 const std::optional<BuilderInfo>& builder = std::nullopt,
+                                 const std::string& grouping = "na") const;
+
+    /**
+     * Post a prepared order action and update local order state
+     */
+    nlohmann::json sendOrders(const PreparedAction& prepared);
+    void sendOrders(const PreparedAction& prepared, ActionResponse& result);
+
     /**
      * Open a market order
      */
@@ -58,6 +99,8 @@ public:
 
     /**
      * Close a position with market order
+     * Sizes and directs the close from positions_ when it is seeded and
+     * fed (see PositionTracker::isFed), otherwise queries userState.
      */
     nlohmann::json marketClose(const std::string& coin,
                               std::optional<double> sz = std::nullopt,
@@ -80,11 +123,13 @@ public:
      * Cancel multiple orders
      */
     nlohmann::json bulkCancel(const std::vector<CancelRequest>& cancels);
+    void bulkCancel(const std::vector<CancelRequest>& cancels, ActionResponse& result);
 
     /**
      * Cancel multiple orders by CLOID
      */
     nlohmann::json bulkCancelByCloid(const std::vector<CancelByCloidRequest>& cancels);
+    void bulkCancelByCloid(const std::vector<CancelByCloidRequest>& cancels, ActionResponse& result);
 
     /**
      * Modify an existing order
@@ -102,6 +147,28 @@ public:
      * Modify multiple orders
      */
     nlohmann::json bulkModifyOrders(const std::vector<ModifyRequest>& modifies);
+    void bulkModifyOrders(const std::vector<ModifyRequest>& modifies, ActionResponse& result);
+
+    /**
+     * Create a quote slot for repeatedly moving one resting order
+     * A cloid is drawn from CloidGenerator::global() if none is given.
+     */
+    QuoteSlot makeQuoteSlot(const std::string& coin,
+                            bool is_buy,
+                            const std::string& tif = "Alo",
+                            const std::optional<Cloid>& cloid = std::nullopt,
+                            bool reduce_only = false);
+
+    /**
+     * Place the slot's order at px/sz
+     */
+    nlohmann::json placeQuote(QuoteSlot& slot, double px, double sz);
+
+    /**
+     * Move the slot's resting order to px/sz with a batchModify on its cloid,
+     * signing the slot's pre-encoded action
+     */
+    nlohmann::json updateQuote(QuoteSlot& slot, double px, double sz);
 
     /**
      * Transfer USD to another address
@@ -139,18 +206,109 @@ public:
      */
     nlohmann::json queryOrderByCloid(const std::string& user, const Cloid& cloid);
 
+    /**
+     * Seed the local position tracker from userState
+     */
+    void syncPositions();
+
+    /**
+     * Seed the local order manager from openOrders
+     */
+    void syncOpenOrders();
+
+    const std::string& vaultAddress() const { return vault_address_; }
+
     /**
      * Set expiration time for actions (optional)
      */
     void setExpiresAfter(std::optional<int64_t> expires_after);
 
+    /**
+     * Replace the nonce allocator (e.g. NonceManager::sharedMemory to
+     * coordinate with other processes signing with the same key)
+     */
+    void setNonceManager(std::shared_ptr<NonceManager> nonces);
+
+    /**
+     * Record this exchange's and its Info's transfers into stats
+     */
+    void setTransferStats(std::shared_ptr<TransferStats> stats) override;
+
+    /**
+     * Rate limit this exchange and its Info with one limiter (null disables)
+     */
+    void setRateLimiter(std::shared_ptr<RateLimiter> limiter) override;
+
+    /**
+     * Applies to this exchange's Info; /exchange actions are never retried
+     */
+    void setRetryPolicy(const RetryPolicy& policy) override;
+
     // Public info object for queries
     Info info_;
 
+    // Local position tracker (seed with syncPositions())
+    PositionTracker positions_;
+
+    // Open orders placed through this exchange, updated from every ack
+    OrderManager order_manager_;
+
 private:
-    nlohmann::json postAction(const nlohmann::json& action,
-                             const Signature& signature,
-                             int64_t nonce);
+    friend class ExchangeRouter;
+
+    template <typename Action>
+    nlohmann::json postAction(const Action& action,
+                              const Signature& signature,
+                              int64_t nonce,
+                              const std::string& vault_address,
+                              std::optional<int64_t> expires_after);
+
+    /**
+     * Post an action and leave the checked response body in response_buffer_
+     * vault_address and expires_after must be the ones it was signed with.
+     */
+    template <typename Action>
+    void postActionRaw(const Action& action,
+                       const Signature& signature,
+                       int64_t nonce,
+                       const std::string& vault_address,
+                       std::optional<int64_t> expires_after);
+
+    /**
+     * Decode response_buffer_ into result; with body set, parse it once into
+     * body and decode from the document (the JSON-returning overloads)
+     */
+    void decodeResponse(ActionResponse& result, nlohmann::json* body = nullptr) const;
+
+    // Actions for an explicit target (vault or sub-account, "" for the
+    // wallet's own account), as used by ExchangeRouter; body as in decodeResponse
+    PreparedAction prepareOrders(const std::vector<OrderRequest>& orders,
+                                 const std::optional<BuilderInfo>& builder,
+                                 const std::string& grouping,
+                                 const std::string& vault_address) const;
+    void sendOrders(const PreparedAction& prepared, ActionResponse& result, nlohmann::json* body);
+    void bulkCancel(const std::vector<CancelRequest>& cancels,
+                    ActionResponse& result,
+                    nlohmann::json* body,
+                    const std::string& vault_address);
+    void bulkCancelByCloid(const std::vector<CancelByCloidRequest>& cancels,
+                           ActionResponse& result,
+                           nlohmann::json* body,
+                           const std::string& vault_address);
+    void bulkModifyOrders(const std::vector<ModifyRequest>& modifies,
+                          ActionResponse& result,
+                          nlohmann::json* body,
+                          const std::string& vault_address);
+    nlohmann::json updateLeverage(int leverage,
+                                  const std::string& coin,
+                                  bool is_cross,
+                                  const std::string& vault_address);
+
+    /**
+     * Account whose state this exchange trades: the vault or sub-account
+     * if one is set, otherwise the wallet's own address
+     */
+    std::string tradingAddress() const;
 
     double slippagePrice(const std::string& name,
                         bool is_buy,
@@ -158,9 +316,20 @@ private:
                         std::optional<double> px = std::nullopt);
 
     std::shared_ptr<Wallet> wallet_;
+    std::shared_ptr<NonceManager> nonces_;
     std::string vault_address_;
     std::string account_address_;
     std::optional<int64_t> expires_after_;
+
+    // Request and response buffers reused across postAction calls
+    std::string payload_buffer_;
+    std::string response_buffer_;
+
+    // Decoded acks for the JSON-returning calls, which still track orders
+    ActionResponse ack_;
+
+    // userState snapshot reused by marketClose when positions_ is not fed
+    ClearinghouseState user_state_;
 };
 
 } // namespace hyperliquid
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "hyperliquid/account_snapshot.hpp"
+#include "hyperliquid/action_response.hpp"
+#include "hyperliquid/exchange.hpp"
+#include "hyperliquid/types.hpp"
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * Routes actions for many vaults and sub-accounts through one Exchange
+ *
+ * Every call names the vault or sub-account it acts for ("" for the
+ * wallet's own account); the target is signed into and sent with that
+ * action only, and the exchange's own target is never changed. All
+ * targets share the exchange's metadata, connections, rate limiter,
+ * wallet and nonce allocator, so adding a target costs nothing beyond
+ * its address. Calls through the router are serialized; as with any
+ * Exchange call, do not route while another thread (an OrderPipeline
+ * sender, an OrderBatcher) is sending through the same exchange.
+ *
+ * The exchange's order_manager_ sees orders of every target (oids are
+ * global). Its positions_ tracker is per account, so do not seed it or
+ * track acks with it while routing several targets; use snapshots().
+ */
+class ExchangeRouter {
+public:
+    explicit ExchangeRouter(Exchange& exchange);
+
+    ExchangeRouter(const ExchangeRouter&) = delete;
+    ExchangeRouter& operator=(const ExchangeRouter&) = delete;
+
+    void bulkOrders(const std::string& vault_address,
+                    const std::vector<OrderRequest>& orders,
+                    ActionResponse& result,
+                    const std::optional<BuilderInfo>& builder = std::nullopt,
+                    const std::string& grouping = "na");
+
+    void bulkCancel(const std::string& vault_address,
+                    const std::vector<CancelRequest>& cancels,
+                    ActionResponse& result);
+
+    void bulkCancelByCloid(const std::string& vault_address,
+                           const std::vector<CancelByCloidRequest>& cancels,
+                           ActionResponse& result);
+
+    void bulkModifyOrders(const std::string& vault_address,
+                          const std::vector<ModifyRequest>& modifies,
+                          ActionResponse& result);
+
+    nlohmann::json updateLeverage(const std::string& vault_address,
+                                  int leverage,
+                                  const std::string& coin,
+                                  bool is_cross = true);
+
+    /**
+     * Poll userState and openOrders of every account in one batch (see
+     * Info::accountSnapshots); snapshots is index-aligned with addresses,
+     * which must be full addresses (the wallet's own included)
+     */
+    void snapshots(const std::vector<std::string>& addresses,
+                   std::vector<AccountSnapshot>& snapshots,
+                   size_t max_in_flight = API::DEFAULT_MAX_IN_FLIGHT);
+
+    Exchange& exchange() { return exchange_; }
+
+private:
+    Exchange& exchange_;
+    std::mutex mutex_;
+    std::vector<AccountRequest> requests_;  // reused by snapshots()
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "hyperliquid/fills.hpp"
+#include <cstdint>
+#include <string>
+
+namespace hyperliquid {
+
+class Info;
+
+/**
+ * Options for FillHistory
+ */
+struct FillHistoryOptions {
+    int64_t window_ms = 24 * 60 * 60 * 1000;  // initial window length
+    size_t max_in_flight = 4;                 // concurrent requests
+    size_t page_limit = 2000;                 // server cap on fills per response
+};
+
+/**
+ * Backfills a user's fills over an arbitrary time range
+ *
+ * The range is split into windows that are fetched concurrently with
+ * Info::userFillsByTimeWindows, paced by the Info's rate limiter. A
+ * window that comes back at the server's page limit is split in half
+ * and fetched again. A 1 ms window at the limit cannot be split; its
+ * fills are delivered as returned and truncated() reports the loss.
+ * Fills are delivered once each (de-duplicated by tid and hash across
+ * window boundaries) in (time, tid) order.
+ */
+class FillHistory {
+public:
+    explicit FillHistory(Info& info, FillHistoryOptions options = FillHistoryOptions());
+
+    /**
+     * Stream all fills for address with start_time <= time <= end_time
+     * Returns the number of fills delivered.
+     */
+    size_t fetch(const std::string& address,
+                 int64_t start_time,
+                 int64_t end_time,
+                 SymbolTable& symbols,
+                 const FillCallback& on_fill);
+
+    /**
+     * Whether the last fetch() hit the page limit in a 1 ms window, so
+     * fills in that millisecond may be missing
+     */
+    bool truncated() const { return truncated_; }
+
+private:
+    Info& info_;
+    FillHistoryOptions options_;
+    bool truncated_ = false;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "hyperliquid/types.hpp"
+#include "hyperliquid/utils/json_stream.hpp"
+#include "hyperliquid/utils/symbol_table.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <utility>
+
+namespace hyperliquid {
+
+/**
+ * Fill side as reported by the API ("B" = buy, "A" = sell)
+ */
+enum class Side : uint8_t {
+    Buy,
+    Sell
+};
+
+/**
+ * One user fill with prices and sizes in fixed point (FIXED_POINT_SCALE)
+ *
+ * coin, dir and fee_token are ids in the SymbolTable of the parser that
+ * produced the fill.
+ */
+struct Fill {
+    uint32_t coin = 0;
+    Side side = Side::Buy;
+    bool crossed = false;
+    int64_t px = 0;
+    int64_t sz = 0;
+    int64_t fee = 0;
+    int64_t closed_pnl = 0;
+    int64_t start_position = 0;
+    int64_t time = 0;
+    int64_t oid = 0;
+    int64_t tid = 0;
+    uint32_t dir = 0;
+    uint32_t fee_token = 0;
+    std::array<uint8_t, 32> hash{};
+    std::optional<Cloid> cloid;
+};
+
+using FillCallback = std::function<void(const Fill&)>;
+
+/**
+ * Identity of a fill for de-duplication: trade id and transaction hash
+ */
+using FillKey = std::pair<int64_t, std::array<uint8_t, 32>>;
+
+inline FillKey fillKey(const Fill& fill) {
+    return FillKey(fill.tid, fill.hash);
+}
+
+/**
+ * Incremental parser for a userFills / userFillsByTime response body
+ *
+ * Bytes are fed as they arrive; each fill is decoded and passed to the
+ * callback as soon as its closing brace is seen. Only the current fill's
+ * bytes are buffered, so memory stays bounded however large the response.
+ */
+class FillParser {
+public:
+    FillParser(SymbolTable& symbols, FillCallback on_fill);
+
+    FillParser(const FillParser&) = delete;
+    FillParser& operator=(const FillParser&) = delete;
+
+    /**
+     * Consume the next chunk of the response body
+     */
+    void feed(const char* data, size_t len);
+
+    /**
+     * Check the body was a complete array; throws otherwise
+     */
+    void finish();
+
+    size_t count() const { return stream_.count(); }
+
+private:
+    void emitFill(std::string_view object);
+
+    SymbolTable& symbols_;
+    FillCallback on_fill_;
+    ObjectArrayStream stream_;
+};
+
+} // namespace hyperliquid
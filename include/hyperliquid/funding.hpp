@@ -0,0 +1,158 @@
+#pragma once
+
+#include "hyperliquid/utils/json_stream.hpp"
+#include "hyperliquid/utils/symbol_table.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+
+class Info;
+
+/**
+ * Funding rate history of one coin in columnar form, ordered by time
+ */
+struct FundingSeries {
+    std::string coin;
+    std::vector<int64_t> time;
+    std::vector<double> rate;     // per funding interval (hourly)
+    std::vector<double> premium;
+
+    size_t size() const { return time.size(); }
+    bool empty() const { return time.empty(); }
+};
+
+/**
+ * A user's funding payments in columnar form, ordered by time
+ *
+ * coin holds ids in the SymbolTable the payments were parsed with.
+ */
+struct UserFunding {
+    std::vector<int64_t> time;
+    std::vector<uint32_t> coin;
+    std::vector<double> usdc;     // payment, negative when paid
+    std::vector<double> szi;      // signed position size at payment
+    std::vector<double> rate;
+
+    size_t size() const { return time.size(); }
+    bool empty() const { return time.empty(); }
+};
+
+/**
+ * One fundingHistory query (coin by canonical name)
+ */
+struct FundingRequest {
+    std::string coin;
+    int64_t start_time = 0;
+    int64_t end_time = 0;
+};
+
+/**
+ * One userFunding query
+ */
+struct UserFundingRequest {
+    std::string user;
+    int64_t start_time = 0;
+    int64_t end_time = 0;
+};
+
+/**
+ * Incremental parser for fundingHistory / userFunding response bodies
+ *
+ * Appends to exactly one of the two outputs, depending on the constructor.
+ */
+class FundingParser {
+public:
+    explicit FundingParser(FundingSeries& out);
+    FundingParser(UserFunding& out, SymbolTable& symbols);
+
+    FundingParser(const FundingParser&) = delete;
+    FundingParser& operator=(const FundingParser&) = delete;
+
+    void feed(const char* data, size_t len);
+    void finish();
+    size_t count() const { return stream_.count(); }
+
+private:
+    void emit(std::string_view object);
+
+    FundingSeries* series_ = nullptr;
+    UserFunding* user_ = nullptr;
+    SymbolTable* symbols_ = nullptr;
+    ObjectArrayStream stream_;
+};
+
+/**
+ * Loads funding history for many coins or accounts concurrently
+ *
+ * The server returns at most PAGE_LIMIT entries per request; full pages
+ * are followed up from their last timestamp (inclusive, since a user's
+ * payments for an hour share one), with every coin (or account) that
+ * still has more data fetched together in each round. The overlap is
+ * de-duplicated on time (time and coin for payments).
+ */
+class FundingLoader {
+public:
+    static constexpr size_t PAGE_LIMIT = 500;
+
+    explicit FundingLoader(Info& info, size_t max_in_flight = 8);
+
+    /**
+     * Funding rates for each coin with start_time <= time <= end_time
+     */
+    std::vector<FundingSeries> load(const std::vector<std::string>& names,
+                                    int64_t start_time,
+                                    int64_t end_time);
+
+    /**
+     * Funding payments for each account with start_time <= time <= end_time
+     */
+    std::vector<UserFunding> loadUsers(const std::vector<std::string>& addresses,
+                                       int64_t start_time,
+                                       int64_t end_time,
+                                       SymbolTable& symbols);
+
+private:
+    Info& info_;
+    size_t max_in_flight_;
+};
+
+/**
+ * Sum of funding rates with start_time <= time <= end_time
+ */
+double cumulativeFunding(const FundingSeries& series, int64_t start_time, int64_t end_time);
+
+/**
+ * Running sum of funding rates, index-aligned with series.time
+ */
+std::vector<double> cumulativeFundingSeries(const FundingSeries& series);
+
+/**
+ * Mean hourly rate over the window, annualised (x 24 x 365)
+ */
+double annualizedFunding(const FundingSeries& series, int64_t start_time, int64_t end_time);
+
+/**
+ * annualizedFunding for every series; index-aligned with the input
+ */
+std::vector<double> annualizedFunding(const std::vector<FundingSeries>& universe,
+                                      int64_t start_time,
+                                      int64_t end_time);
+
+/**
+ * Funding PnL of holding szi at price px over the window
+ * Longs pay positive funding: -szi * px * sum(rate).
+ */
+double fundingPnl(const FundingSeries& series,
+                  double szi,
+                  double px,
+                  int64_t start_time,
+                  int64_t end_time);
+
+/**
+ * Total payment per coin id (vector sized to symbols.size())
+ */
+std::vector<double> fundingPaidByCoin(const UserFunding& payments, const SymbolTable& symbols);
+
+} // namespace hyperliquid
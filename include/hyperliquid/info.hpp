@@ -1,7 +1,16 @@
 #pragma once
 
+#include "hyperliquid/account_snapshot.hpp"
 #include "hyperliquid/api.hpp"
+#include "hyperliquid/candles.hpp"
+#include "hyperliquid/clearinghouse.hpp"
+#include "hyperliquid/fills.hpp"
+#include "hyperliquid/funding.hpp"
+#include "hyperliquid/order_book.hpp"
 #include "hyperliquid/types.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <optional>
@@ -13,6 +22,8 @@ namespace hyperliquid {
  */
 class Info : public API {
 public:
+    static constexpr int64_t DEFAULT_MID_STALENESS_MS = 1000;
+
     explicit Info(const std::string& base_url = "",
                  bool skip_ws = true,
                  const Meta* meta = nullptr,
@@ -35,6 +46,31 @@ public:
      */
     nlohmann::json userState(const std::string& address, const std::string& dex = "");
 
+    /**
+     * Typed userState decoded straight into a caller-owned state
+     * Reuse the same instance when polling to avoid reallocating it.
+     */
+    void userState(const std::string& address,
+                   ClearinghouseState& state,
+                   const std::string& dex = "");
+
+    /**
+     * Poll several accounts concurrently into typed snapshots
+     *
+     * The queries of all requests go out together over pooled connections,
+     * at most max_in_flight at a time, each waiting on the rate limiter.
+     * Each query is retried and hedged on its own under the retry policy.
+     * snapshots is resized to match requests (same order) and its storage
+     * is reused across calls. Throws the first failure that survives its
+     * retries once all queries have finished.
+     */
+    void accountSnapshots(const std::vector<AccountRequest>& requests,
+                          std::vector<AccountSnapshot>& snapshots,
+                          size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
+    std::vector<AccountSnapshot> accountSnapshots(const std::vector<AccountRequest>& requests,
+                                                  size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
     /**
      * Query spot user state (balances, spot positions)
      */
@@ -82,6 +118,33 @@ public:
      */
     nlohmann::json allMids(const std::string& dex = "");
 
+    /**
+     * Fetch allMids and refresh the mid-price cache
+     */
+    void refreshMids(const std::string& dex = "");
+
+    /**
+     * Apply an allMids stream message (or allMids response) to the mid-price cache
+     */
+    void applyAllMids(const nlohmann::json& msg);
+
+    /**
+     * Cached mid price for a coin, or nullopt if missing or older than the staleness bound
+     */
+    std::optional<double> cachedMid(const std::string& name) const;
+
+    /**
+     * Mid price for pricing decisions
+     * Uses a fresh local order book, then the mid-price cache, and only
+     * falls back to an allMids request when both are stale or missing.
+     */
+    double midPrice(const std::string& name);
+
+    /**
+     * Maximum age of cached mids and local books used by midPrice()
+     */
+    void setMidStaleness(std::chrono::milliseconds max_age);
+
     /**
      * Get user fills (trades)
      */
@@ -94,6 +157,66 @@ public:
                                    int64_t start_time,
                                    std::optional<int64_t> end_time = std::nullopt);
 
+    /**
+     * Stream the user's fills without building a JSON document
+     *
+     * Each fill is decoded as soon as its bytes arrive and passed to
+     * on_fill; coins are interned in symbols. Returns the number of fills.
+     */
+    size_t userFillsStream(const std::string& address,
+                           SymbolTable& symbols,
+                           const FillCallback& on_fill);
+
+    /**
+     * Streaming form of userFillsByTime()
+     */
+    size_t userFillsByTimeStream(const std::string& address,
+                                 int64_t start_time,
+                                 std::optional<int64_t> end_time,
+                                 SymbolTable& symbols,
+                                 const FillCallback& on_fill);
+
+    /**
+     * Fetch userFillsByTime for several [start, end] windows concurrently
+     *
+     * Fills are streamed to on_fill tagged with the index of their window;
+     * callbacks for different windows may interleave.
+     */
+    using WindowFillCallback = std::function<void(size_t window, const Fill& fill)>;
+    void userFillsByTimeWindows(const std::string& address,
+                                const std::vector<std::pair<int64_t, int64_t>>& windows,
+                                SymbolTable& symbols,
+                                const WindowFillCallback& on_fill,
+                                size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
+    /**
+     * Get funding rate history for a coin
+     */
+    nlohmann::json fundingHistory(const std::string& name,
+                                  int64_t start_time,
+                                  std::optional<int64_t> end_time = std::nullopt);
+
+    /**
+     * Get a user's funding payment history
+     */
+    nlohmann::json userFundingHistory(const std::string& user,
+                                      int64_t start_time,
+                                      std::optional<int64_t> end_time = std::nullopt);
+
+    /**
+     * Run several fundingHistory queries concurrently into columnar series
+     * Results are in request order; see FundingLoader for paging.
+     */
+    std::vector<FundingSeries> fundingHistoryMany(const std::vector<FundingRequest>& requests,
+                                                  size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
+    /**
+     * Run several userFunding queries concurrently (coins interned in symbols)
+     */
+    std::vector<UserFunding> userFundingHistoryMany(const std::vector<UserFundingRequest>& requests,
+                                                    SymbolTable& symbols,
+                                                    size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
     /**
      * Get perpetuals metadata
      */
@@ -109,6 +232,43 @@ public:
      */
     nlohmann::json l2Snapshot(const std::string& name);
 
+    /**
+     * Get OHLCV candles with open time in [start_time, end_time]
+     *
+     * The server returns at most 5000 candles per request; use CandleCache
+     * for longer ranges.
+     */
+    Candles candlesSnapshot(const std::string& name,
+                            const std::string& interval,
+                            int64_t start_time,
+                            int64_t end_time);
+
+    /**
+     * Run several candleSnapshot queries concurrently (coins by canonical name)
+     * Results are in request order.
+     */
+    std::vector<Candles> candlesSnapshotMany(const std::vector<CandleRequest>& requests,
+                                             size_t max_in_flight = DEFAULT_MAX_IN_FLIGHT);
+
+    /**
+     * Fetch an L2 snapshot and rebuild the local order book for a coin
+     * The returned book is updated in place by later syncs and
+     * applyL2Book(); only read it from the thread that feeds the books.
+     */
+    const OrderBook& syncOrderBook(const std::string& name);
+
+    /**
+     * Apply an l2Book stream message (or l2Book response) to the local book
+     * The book is created on first use, keyed by the message's coin
+     */
+    void applyL2Book(const nlohmann::json& msg);
+
+    /**
+     * Local order book for a coin, or nullptr if it was never synced
+     * Same caveat as syncOrderBook(); midPrice() is safe from any thread.
+     */
+    const OrderBook* orderBook(const std::string& name) const;
+
     /**
      * Query order by OID
      */
@@ -142,6 +302,32 @@ private:
                            const std::vector<std::string>* perp_dexs);
 
     void setPerpMeta(const Meta& meta, int offset);
+
+    void storeMids(const nlohmann::json& mids);
+
+    /**
+     * Mid of the local book for a canonical coin if it is fresh
+     */
+    std::optional<double> freshBookMid(const std::string& coin) const;
+
+    // Request and response buffers reused by the typed queries
+    std::string request_buffer_;
+    std::string response_buffer_;
+    std::vector<std::string> batch_buffers_;
+
+    // Local order books keyed by canonical coin name (may be fed from another thread)
+    mutable std::mutex books_mutex_;
+    std::unordered_map<std::string, OrderBook> order_books_;
+
+    struct CachedMid {
+        double px;
+        int64_t updated_ms;
+    };
+
+    // Mid-price cache keyed by canonical coin name (may be fed from another thread)
+    mutable std::mutex mids_mutex_;
+    std::unordered_map<std::string, CachedMid> mids_;
+    std::atomic<int64_t> mid_staleness_ms_{DEFAULT_MID_STALENESS_MS};
 };
 
 } // namespace hyperliquid
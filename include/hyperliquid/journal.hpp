@@ -0,0 +1,199 @@
+#pragma once
+
+#include "hyperliquid/fills.hpp"
+#include "hyperliquid/order_manager.hpp"
+#include "hyperliquid/utils/symbol_table.hpp"
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+
+class FillHistory;
+
+/**
+ * Kind of a journal record
+ */
+enum class JournalRecordType : uint8_t {
+    Symbol = 1,  // defines a coin/dir/token name for an id
+    Fill = 2,
+    Order = 3    // order state change
+};
+
+/**
+ * Fixed-size 128-byte journal record (native byte order)
+ *
+ * Prices and sizes are fixed point (FIXED_POINT_SCALE). coin, dir and
+ * fee_token are ids defined by earlier Symbol records in the same file.
+ */
+struct JournalRecord {
+    static constexpr uint8_t FLAG_CROSSED = 0x01;
+    static constexpr uint8_t FLAG_HAS_CLOID = 0x02;
+
+    JournalRecordType type;
+    uint8_t side;     // Side
+    uint8_t flags;
+    uint8_t state;    // OrderState (order records)
+    uint32_t coin;    // symbol id (the defined id for Symbol records)
+    int64_t time;
+    int64_t oid;
+    int64_t px;
+    int64_t sz;       // fill size, or remaining size for orders
+    uint64_t cloid_hi;
+    uint64_t cloid_lo;
+    union {
+        struct {
+            int64_t tid;
+            int64_t fee;
+            int64_t closed_pnl;
+            int64_t start_position;
+            uint32_t dir;
+            uint32_t fee_token;
+            uint8_t hash[32];
+        } fill;
+        struct {
+            int64_t orig_sz;
+            int32_t asset;
+        } order;
+        char name[72];  // Symbol records, NUL-padded
+    };
+};
+
+static_assert(sizeof(JournalRecord) == 128, "JournalRecord must stay 128 bytes");
+
+/**
+ * Append-only binary journal of fills and order state changes
+ *
+ * Records are buffered and written with O_APPEND; a torn record left by
+ * a crash is truncated away on the next open. Names are interned into
+ * the journal's own symbol table and written once as Symbol records.
+ * Thread-safe.
+ */
+class JournalWriter {
+public:
+    static constexpr size_t BUFFERED_RECORDS = 64;
+
+    /**
+     * Open or create the journal at path and recover its state
+     */
+    explicit JournalWriter(const std::string& path);
+    ~JournalWriter();
+
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter& operator=(const JournalWriter&) = delete;
+
+    /**
+     * Append a fill whose ids refer to symbols
+     */
+    void appendFill(const Fill& fill, const SymbolTable& symbols);
+
+    /**
+     * Append an order state change (order.state at order.updated_ms)
+     */
+    void appendOrder(const TrackedOrder& order);
+
+    /**
+     * Write buffered records; with durable, also fsync
+     */
+    void flush(bool durable = false);
+
+    /**
+     * Fetch and append fills newer than the last journaled one
+     * Fills at the last journaled timestamp are de-duplicated by (tid, hash).
+     * Check history.truncated() afterwards for fills lost to the page limit.
+     * start_time is where an empty journal starts from and is required
+     * then (scanning from the epoch would take hours); it is ignored once
+     * the journal holds fills. Returns the number of fills appended.
+     */
+    size_t syncFills(FillHistory& history,
+                     const std::string& address,
+                     int64_t end_time,
+                     std::optional<int64_t> start_time = std::nullopt);
+
+    /**
+     * Timestamp of the newest journaled fill (0 if none)
+     */
+    int64_t lastFillTime() const;
+
+private:
+    uint32_t symbolLocked(std::string_view name);
+    void pushLocked(const JournalRecord& record);
+    void flushLocked();
+    void recover();
+
+    std::string path_;
+    int fd_ = -1;
+
+    mutable std::mutex mutex_;
+    std::vector<JournalRecord> buffer_;
+    SymbolTable symbols_;
+    int64_t last_fill_time_ = 0;
+    std::set<FillKey> last_fill_keys_;  // fills at last_fill_time_
+};
+
+/**
+ * Memory-mapped read view of a journal with time and coin indexes
+ *
+ * Maps the file as it was when opened; records appended later are not
+ * visible. Fills are returned with ids in symbols().
+ */
+class JournalReader {
+public:
+    explicit JournalReader(const std::string& path);
+    ~JournalReader();
+
+    JournalReader(const JournalReader&) = delete;
+    JournalReader& operator=(const JournalReader&) = delete;
+
+    size_t recordCount() const { return record_count_; }
+    const JournalRecord& record(size_t index) const { return records_[index]; }
+    const SymbolTable& symbols() const { return symbols_; }
+
+    size_t fillCount() const { return by_time_.size(); }
+    int64_t lastFillTime() const;
+
+    /**
+     * Fills with start_time <= time <= end_time in time order
+     */
+    void fillsBetween(int64_t start_time, int64_t end_time, const FillCallback& on_fill) const;
+
+    /**
+     * Same, restricted to one coin
+     */
+    void fillsForCoin(const std::string& coin,
+                      int64_t start_time,
+                      int64_t end_time,
+                      const FillCallback& on_fill) const;
+
+    /**
+     * Order state changes in journal order
+     */
+    void orderEvents(const std::function<void(const TrackedOrder&)>& on_order) const;
+
+    /**
+     * Decode a Fill record
+     */
+    Fill toFill(const JournalRecord& record) const;
+
+private:
+    void scan(const std::vector<uint32_t>& index,
+              int64_t start_time,
+              int64_t end_time,
+              const FillCallback& on_fill) const;
+
+    void* mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    const JournalRecord* records_ = nullptr;
+    size_t record_count_ = 0;
+
+    SymbolTable symbols_;
+    std::vector<uint32_t> by_time_;               // fill record indexes by time
+    std::vector<std::vector<uint32_t>> by_coin_;  // per coin id, by time
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "hyperliquid/action_response.hpp"
+#include "hyperliquid/types.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace hyperliquid {
+
+class Exchange;
+
+/**
+ * Opt-in coalescing stage in front of an Exchange
+ *
+ * Orders, cancels and modifies submitted from any thread are collected
+ * for up to `window` after the first pending item and sent as single
+ * order / cancel / batchModify actions of at most `max_batch` items each.
+ * Actions go out in submission order: a run of same-kind submissions
+ * shares one action, and a change of kind (or a full action) closes the
+ * current batch and sends everything pending. Each caller receives a
+ * future holding its own decoded status from the response; if the whole
+ * action fails, every future in that batch receives the exception.
+ *
+ * While a batcher is running it owns the Exchange's connection: do not
+ * call the Exchange directly from other threads.
+ */
+class OrderBatcher {
+public:
+    static constexpr size_t DEFAULT_MAX_BATCH = 40;
+
+    explicit OrderBatcher(Exchange& exchange,
+                          std::chrono::microseconds window = std::chrono::microseconds(500),
+                          size_t max_batch = DEFAULT_MAX_BATCH,
+                          const std::optional<BuilderInfo>& builder = std::nullopt);
+
+    /**
+     * Flushes pending items and stops the worker
+     */
+    ~OrderBatcher();
+
+    OrderBatcher(const OrderBatcher&) = delete;
+    OrderBatcher& operator=(const OrderBatcher&) = delete;
+
+    std::future<OrderStatus> submitOrder(const OrderRequest& order);
+    std::future<OrderStatus> submitCancel(const CancelRequest& cancel);
+    std::future<OrderStatus> submitCancelByCloid(const CancelByCloidRequest& cancel);
+    std::future<OrderStatus> submitModify(const ModifyRequest& modify);
+
+    /**
+     * Send everything pending now without waiting for the window
+     */
+    void flush();
+
+private:
+    template <typename Request>
+    struct Pending {
+        std::vector<Request> requests;
+        std::vector<std::promise<OrderStatus>> promises;
+
+        bool empty() const { return requests.empty(); }
+        size_t size() const { return requests.size(); }
+    };
+
+    using Batch = std::variant<Pending<OrderRequest>, Pending<CancelRequest>,
+                               Pending<CancelByCloidRequest>, Pending<ModifyRequest>>;
+
+    template <typename Request>
+    std::future<OrderStatus> enqueue(const Request& request);
+
+    bool batchClosedLocked() const;
+    void run();
+    void send();
+
+    void sendBatch(Pending<OrderRequest>& batch);
+    void sendBatch(Pending<CancelRequest>& batch);
+    void sendBatch(Pending<CancelByCloidRequest>& batch);
+    void sendBatch(Pending<ModifyRequest>& batch);
+
+    template <typename Request, typename SendFn>
+    void dispatch(Pending<Request>& batch, SendFn send_fn);
+
+    Exchange& exchange_;
+    std::chrono::microseconds window_;
+    size_t max_batch_;
+    std::optional<BuilderInfo> builder_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    bool flush_requested_ = false;
+    std::chrono::steady_clock::time_point first_pending_;
+
+    std::deque<Batch> batches_;  // submission order; only the last one is still open
+
+    ActionResponse response_;  // reused by the worker for every batch
+
+    std::thread worker_;
+};
+
+} // namespace hyperliquid
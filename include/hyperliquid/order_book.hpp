@@ -0,0 +1,112 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+/**
+ * Price level returned by order book queries
+ */
+struct BookLevel {
+    double px;
+    double sz;
+    int n;  // number of orders at this level
+};
+
+/**
+ * Local L2 order book for a single coin
+ *
+ * Levels are kept in contiguous arrays with 8-decimal fixed-point keys.
+ * Each side is sorted so that the best level sits at the back, which makes
+ * best bid/ask O(1) and keeps updates near the top of the book cheap.
+ *
+ * Not thread-safe: callers must serialize updates and queries.
+ */
+class OrderBook {
+public:
+    explicit OrderBook(std::string coin = "");
+
+    /**
+     * Replace both sides from an l2Book response or l2Book stream message
+     * Accepts either {"coin", "time", "levels"} or {"channel", "data": {...}}
+     */
+    void applySnapshot(const nlohmann::json& book);
+
+    /**
+     * Set a single price level (size 0 removes the level)
+     */
+    void updateLevel(bool is_bid, double px, double sz, int n = 0);
+
+    /**
+     * Remove all levels
+     */
+    void clear();
+
+    bool empty() const { return bids_.empty() && asks_.empty(); }
+    const std::string& coin() const { return coin_; }
+
+    /**
+     * Exchange timestamp of the last applied snapshot (ms)
+     */
+    int64_t time() const { return time_; }
+
+    /**
+     * Local timestamp of the last update (ms)
+     */
+    int64_t updatedMs() const { return updated_ms_; }
+
+    std::optional<double> bestBid() const;
+    std::optional<double> bestAsk() const;
+
+    /**
+     * Mid price, available only when both sides are present
+     */
+    std::optional<double> mid() const;
+
+    /**
+     * Top N levels of a side, best first
+     */
+    std::vector<BookLevel> depth(bool is_bid, size_t levels) const;
+
+    /**
+     * Total size resting in the top N levels of a side
+     */
+    double depthSize(bool is_bid, size_t levels) const;
+
+    /**
+     * Volume-weighted average price to fill sz against the book
+     * Buys consume asks, sells consume bids. Returns nullopt if the
+     * visible book is too thin to fill the full size.
+     */
+    std::optional<double> vwap(bool is_buy, double sz) const;
+
+    /**
+     * Worst price touched when filling sz (the limit price needed)
+     * Returns nullopt if the visible book is too thin.
+     */
+    std::optional<double> fillPrice(bool is_buy, double sz) const;
+
+private:
+    struct Level {
+        int64_t px;  // fixed-point (8 decimals)
+        int64_t sz;  // fixed-point (8 decimals)
+        int32_t n;
+    };
+
+    static void parseSide(const nlohmann::json& levels, std::vector<Level>& out, bool is_bid);
+
+    // Returns false if the side cannot cover sz; otherwise fills notional and worst price
+    bool walk(bool is_buy, int64_t sz, double& notional, int64_t& worst_px) const;
+
+    std::string coin_;
+    std::vector<Level> bids_;  // ascending by price, best bid at back
+    std::vector<Level> asks_;  // descending by price, best ask at back
+    int64_t time_ = 0;
+    int64_t updated_ms_ = 0;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "hyperliquid/action_response.hpp"
+#include "hyperliquid/types.hpp"
+#include <string>
+#include <vector>
+#include <optional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+class Info;
+class JournalWriter;
+
+/**
+ * Lifecycle state of a tracked order
+ */
+enum class OrderState {
+    Resting,   // acknowledged and on the book
+    Filled,    // fully filled
+    Canceled,  // canceled by us or by the exchange
+    Rejected   // rejected at placement
+};
+
+/**
+ * Locally tracked order
+ */
+struct TrackedOrder {
+    int64_t oid = 0;
+    std::optional<Cloid> cloid;
+    int asset = 0;
+    std::string coin;
+    bool is_buy = false;
+    double limit_px = 0.0;
+    double sz = 0.0;       // remaining size
+    double orig_sz = 0.0;
+    OrderState state = OrderState::Resting;
+    int64_t updated_ms = 0;
+};
+
+/**
+ * Local order manager with an open-order index keyed by oid and cloid
+ *
+ * Orders live in a contiguous array; two hash indexes map oid and cloid
+ * to array slots. Only open (resting) orders are kept: once an order
+ * reaches a terminal state it is dropped from the index. Fed from
+ * order/cancel/modify responses and the orderUpdates stream. Thread-safe.
+ */
+class OrderManager {
+public:
+    /**
+     * Record the outcome of an order action
+     * orders and assets must be index-aligned with the submitted orders.
+     */
+    void onOrderResponse(const std::vector<OrderRequest>& orders,
+                         const std::vector<int>& assets,
+                         const ActionResponse& response,
+                         const Info& info);
+
+    /**
+     * Record the outcome of a cancel action (targets index-aligned with cancels)
+     */
+    void onCancelResponse(const std::vector<OidOrCloid>& targets,
+                          const ActionResponse& response);
+
+    /**
+     * Record the outcome of a batchModify action
+     * modifies and assets must be index-aligned with the submitted modifies.
+     */
+    void onModifyResponse(const std::vector<ModifyRequest>& modifies,
+                          const std::vector<int>& assets,
+                          const ActionResponse& response,
+                          const Info& info);
+
+    /**
+     * Reconcile with an orderUpdates stream message (or array of updates)
+     */
+    void applyOrderUpdates(const nlohmann::json& msg, const Info& info);
+
+    /**
+     * Replace the index from an openOrders response
+     */
+    void seed(const nlohmann::json& open_orders, const Info& info);
+
+    std::optional<TrackedOrder> findByOid(int64_t oid) const;
+    std::optional<TrackedOrder> findByCloid(const Cloid& cloid) const;
+
+    /**
+     * All open orders, optionally filtered by asset
+     */
+    std::vector<TrackedOrder> openOrders() const;
+    std::vector<TrackedOrder> openOrders(int asset) const;
+
+    size_t openCount() const;
+    void clear();
+
+    /**
+     * Record every order state change in a journal (nullptr to stop)
+     * Records are appended after the index lock is released, so changes
+     * made concurrently from two threads may be journaled in either order.
+     */
+    void setJournal(std::shared_ptr<JournalWriter> journal);
+
+private:
+    // State changes to journal once mutex_ is released (only collected with a journal set)
+    using Changes = std::vector<TrackedOrder>;
+
+    void upsertLocked(const TrackedOrder& order, Changes& changes);
+    void removeLocked(size_t slot, OrderState state, Changes& changes);
+    std::optional<size_t> slotLocked(const OidOrCloid& target) const;
+
+    mutable std::mutex mutex_;
+    std::vector<TrackedOrder> orders_;
+    std::unordered_map<int64_t, size_t> by_oid_;
+    std::unordered_map<Cloid, size_t> by_cloid_;
+    std::shared_ptr<JournalWriter> journal_;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "hyperliquid/exchange.hpp"
+#include "hyperliquid/utils/spsc_queue.hpp"
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+/**
+ * Two-stage order submission: sign on one thread, send on another
+ *
+ * submit() queues an order action. A signer thread rounds, encodes and
+ * signs it (Exchange::prepareOrders) and hands it to a sender thread
+ * through a bounded SPSC queue of `depth` entries; the sender posts it
+ * (Exchange::sendOrders). While one request is in flight the next is
+ * already being signed, so sustained throughput is bounded by
+ * max(sign, round trip) rather than their sum. Actions are sent in
+ * submission order, which keeps their nonces increasing on the wire.
+ *
+ * While a pipeline is running it owns the Exchange's connection: do not
+ * call the Exchange directly from other threads.
+ */
+class OrderPipeline {
+public:
+    static constexpr size_t DEFAULT_DEPTH = 4;
+
+    explicit OrderPipeline(Exchange& exchange, size_t depth = DEFAULT_DEPTH);
+
+    /**
+     * Sends everything already submitted and stops both stages
+     */
+    ~OrderPipeline();
+
+    OrderPipeline(const OrderPipeline&) = delete;
+    OrderPipeline& operator=(const OrderPipeline&) = delete;
+
+    /**
+     * Queue an order action; the future holds the full /exchange response
+     */
+    std::future<nlohmann::json> submit(const std::vector<OrderRequest>& orders,
+                                       const std::optional<BuilderInfo>& builder = std::nullopt,
+                                       const std::string& grouping = "na");
+
+    std::future<nlohmann::json> submit(const OrderRequest& order,
+                                       const std::optional<BuilderInfo>& builder = std::nullopt);
+
+private:
+    struct Job {
+        std::vector<OrderRequest> orders;
+        std::optional<BuilderInfo> builder;
+        std::string grouping;
+        std::promise<nlohmann::json> promise;
+    };
+
+    struct Signed {
+        std::optional<PreparedAction> prepared;  // empty if signing failed
+        std::promise<nlohmann::json> promise;
+        bool last = false;                       // shutdown marker
+    };
+
+    void runSigner();
+    void runSender();
+    void handOff(Signed&& item);
+
+    Exchange& exchange_;
+    SpscQueue<Signed> signed_;
+
+    std::mutex intake_mutex_;
+    std::condition_variable intake_cv_;
+    std::deque<Job> intake_;
+    bool stopping_ = false;
+
+    std::mutex sender_mutex_;
+    std::condition_variable sender_cv_;
+
+    // Signer waits here while the queue is full
+    std::mutex space_mutex_;
+    std::condition_variable space_cv_;
+
+    std::thread signer_;
+    std::thread sender_;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "hyperliquid/action_response.hpp"
+#include <string>
+#include <vector>
+#include <optional>
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+class Info;
+
+/**
+ * Locally tracked perpetual position
+ */
+struct Position {
+    int asset;
+    std::string coin;
+    double szi;       // signed size: positive long, negative short
+    double entry_px;
+    int64_t updated_ms;
+};
+
+/**
+ * Local position tracker indexed by asset id
+ *
+ * Seed it from userState, then keep it current from either a fills feed
+ * (userFills / userEvents stream messages) or the Exchange's own order
+ * acks - not both, or fills will be counted twice. Thread-safe.
+ */
+class PositionTracker {
+public:
+    /**
+     * Replace all positions from a clearinghouseState (userState) response
+     */
+    void seed(const nlohmann::json& user_state, const Info& info);
+
+    /**
+     * Apply fills from a userFills / userEvents stream message or a fills array
+     * Snapshot messages (isSnapshot: true) are ignored, since seed() covers them.
+     */
+    void applyFills(const nlohmann::json& msg, const Info& info);
+
+    /**
+     * Apply a single fill to the position for an asset
+     */
+    void applyFill(int asset, const std::string& coin, bool is_buy, double sz, double px);
+
+    /**
+     * Apply fills reported in an order response
+     * assets and sides must be index-aligned with the submitted orders.
+     */
+    void applyOrderResponse(const ActionResponse& response,
+                            const std::vector<int>& assets,
+                            const std::vector<bool>& is_buy,
+                            const std::vector<std::string>& coins);
+
+    /**
+     * Current position for an asset, or nullopt if flat or unknown
+     */
+    std::optional<Position> position(int asset) const;
+
+    /**
+     * All non-flat positions
+     */
+    std::vector<Position> positions() const;
+
+    /**
+     * Whether seed() has been called
+     */
+    bool isSeeded() const;
+
+    /**
+     * Whether the tracker is seeded and kept current: fills have been
+     * applied to it (a fills subscription is attached) or order acks are
+     * tracked. Acks alone miss resting orders that fill later.
+     */
+    bool isFed() const;
+
+    /**
+     * Let Exchange apply fills from its own order acks
+     */
+    void setTrackOrderAcks(bool enabled);
+    bool tracksOrderAcks() const;
+
+    void clear();
+
+private:
+    void applyFillLocked(int asset, const std::string& coin, bool is_buy, double sz, double px);
+
+    mutable std::mutex mutex_;
+    std::unordered_map<int, Position> positions_;
+    bool seeded_ = false;
+    bool fed_by_fills_ = false;  // applyFills() / applyFill() called since clear()
+    bool track_order_acks_ = false;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "hyperliquid/types.hpp"
+#include <string>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+/**
+ * Pre-encoded cancel/replace state for one resting quote
+ *
+ * A slot fixes the asset, side, time-in-force and cloid of a quote and
+ * keeps the batchModify action that moves it, already msgpack-encoded.
+ * update() only re-rounds price and size and splices their wire strings
+ * between the fixed template segments, so the action is ready to hash
+ * and sign without rebuilding the order wire. Create slots with
+ * Exchange::makeQuoteSlot().
+ */
+class QuoteSlot {
+public:
+    QuoteSlot(int asset,
+              const std::string& coin,
+              bool is_buy,
+              const std::string& tif,
+              const Cloid& cloid,
+              int sz_decimals,
+              bool reduce_only = false);
+
+    /**
+     * Round price/size to tick/lot size and patch them into the wire state
+     */
+    void update(double px, double sz);
+
+    /**
+     * Msgpack encoding of the batchModify action for the current price/size
+     */
+    const std::string& packedAction() const { return packed_; }
+
+    /**
+     * JSON form of the same action, for the request body
+     */
+    const nlohmann::ordered_json& action() const { return action_; }
+
+    /**
+     * Equivalent modify request (for order tracking)
+     */
+    ModifyRequest modifyRequest() const;
+
+    int asset() const { return asset_; }
+    const std::string& coin() const { return coin_; }
+    bool isBuy() const { return is_buy_; }
+    const std::string& tif() const { return tif_; }
+    const Cloid& cloid() const { return cloid_; }
+    bool reduceOnly() const { return reduce_only_; }
+    double px() const { return px_; }
+    double sz() const { return sz_; }
+
+private:
+    int asset_;
+    std::string coin_;
+    bool is_buy_;
+    std::string tif_;
+    Cloid cloid_;
+    int sz_decimals_;
+    bool is_spot_;
+    bool reduce_only_;
+
+    double px_ = 0.0;
+    double sz_ = 0.0;
+
+    // Msgpack template segments around the "p" and "s" string values
+    std::string prefix_;
+    std::string middle_;
+    std::string suffix_;
+
+    std::string packed_;
+    nlohmann::ordered_json action_;
+};
+
+} // namespace hyperliquid
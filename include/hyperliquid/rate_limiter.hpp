@@ -0,0 +1,105 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+
+namespace hyperliquid {
+
+/**
+ * Priority lanes: cancels may use a reserve the normal lane cannot touch
+ * and are served before waiting normal requests
+ */
+enum class RateLane {
+    Normal,
+    Priority
+};
+
+struct RateLimitConfig {
+    double weight_per_minute = 1200.0;  // REST weight allowed per IP per minute
+    double burst = 200.0;               // weight that may be spent at once
+    double priority_reserve = 50.0;     // part of the burst held for the priority lane
+    std::chrono::milliseconds min_backoff{1000};   // first pause after a 429
+    std::chrono::milliseconds max_backoff{60000};  // cap for repeated 429s
+};
+
+/**
+ * Token bucket over request weights
+ *
+ * The bucket holds up to `burst` weight and refills at
+ * (weight_per_minute - burst) per minute, so no rolling one-minute window
+ * ever exceeds weight_per_minute. A 429 empties the bucket and blocks all
+ * lanes for Retry-After (or an exponential backoff) until a request
+ * succeeds again.
+ *
+ * Only the IP weight budget is modeled; per-address limits, which depend
+ * on traded volume, are left to the 429 backoff.
+ */
+class RateLimiter {
+public:
+    explicit RateLimiter(const RateLimitConfig& config = RateLimitConfig());
+
+    RateLimiter(const RateLimiter&) = delete;
+    RateLimiter& operator=(const RateLimiter&) = delete;
+
+    /**
+     * Block until weight can be spent in the given lane
+     */
+    void acquire(double weight, RateLane lane = RateLane::Normal);
+
+    /**
+     * Spend weight if it is available now
+     */
+    bool tryAcquire(double weight, RateLane lane = RateLane::Normal);
+
+    /**
+     * Back off after a 429; retry_after of zero uses exponential backoff
+     */
+    void onRateLimited(std::chrono::milliseconds retry_after = std::chrono::milliseconds(0));
+
+    /**
+     * Reset the backoff after a successful response
+     */
+    void onSuccess();
+
+    /**
+     * Weight currently in the bucket
+     */
+    double available();
+
+    const RateLimitConfig& config() const { return config_; }
+
+    /**
+     * Documented weight of a request: 1 + floor(batch / 40) for exchange
+     * actions, 2 for the light /info types, 60 for userRole, 20 otherwise
+     */
+    static double requestWeight(const std::string& url_path,
+                                const std::string& type,
+                                size_t batch_length = 0);
+
+    /**
+     * Cancels (and the dead man's switch) go in the priority lane
+     */
+    static RateLane laneFor(const std::string& type);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void refillLocked(Clock::time_point now);
+    bool trySpendLocked(double weight, RateLane lane, Clock::time_point now);
+
+    RateLimitConfig config_;
+    double refill_per_ms_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    double tokens_;
+    Clock::time_point last_refill_;
+    Clock::time_point blocked_until_;
+    std::chrono::milliseconds backoff_{0};
+    size_t priority_waiting_ = 0;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "hyperliquid/utils/latency.hpp"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * Timing and size of one HTTP transfer, as reported by libcurl
+ *
+ * dns, connect, tls and server are consecutive phases in microseconds;
+ * server runs from the connection being ready to the first response byte
+ * (sending the request, one round trip and server processing). ttfb and
+ * total are measured from the start of the transfer. Phases a reused
+ * connection skips are zero.
+ */
+struct TransferTiming {
+    std::string endpoint;  // URL path, e.g. "/info"
+    std::string type;      // request "type", or the action type for /exchange
+    long status = 0;
+    int64_t dns_us = 0;
+    int64_t connect_us = 0;
+    int64_t tls_us = 0;
+    int64_t server_us = 0;
+    int64_t ttfb_us = 0;
+    int64_t total_us = 0;
+    int64_t bytes_sent = 0;
+    int64_t bytes_received = 0;
+    bool reused_connection = false;
+};
+
+/**
+ * Aggregate of all transfers for one (endpoint, type) pair
+ *
+ * Histograms hold nanoseconds, like the other LatencyHistogram users.
+ */
+struct TransferSummary {
+    std::string endpoint;
+    std::string type;
+    uint64_t count = 0;
+    uint64_t reused = 0;
+    uint64_t errors = 0;  // transfers that failed before a response
+    uint64_t retries = 0;
+    uint64_t hedges = 0;      // duplicate requests fired for slow /info queries
+    uint64_t hedge_wins = 0;  // hedges that answered before the original
+    int64_t bytes_sent = 0;
+    int64_t bytes_received = 0;
+    LatencyHistogram dns;
+    LatencyHistogram connect;
+    LatencyHistogram tls;
+    LatencyHistogram server;
+    LatencyHistogram ttfb;
+    LatencyHistogram total;
+};
+
+/**
+ * Thread-safe per-endpoint, per-type aggregation of transfer timings
+ *
+ * Every API client records into one of these; Exchange shares its
+ * instance with its Info so /info and /exchange land side by side.
+ */
+class TransferStats {
+public:
+    void record(const TransferTiming& timing);
+    void recordError(const std::string& endpoint, const std::string& type);
+    void recordRetry(const std::string& endpoint, const std::string& type);
+    void recordHedge(const std::string& endpoint, const std::string& type, bool won);
+
+    /**
+     * Quantile q of total transfer time in nanoseconds, or -1 with fewer
+     * than min_count samples
+     */
+    int64_t totalPercentile(const std::string& endpoint,
+                            const std::string& type,
+                            double q,
+                            uint64_t min_count) const;
+
+    /**
+     * Copy of all summaries, ordered by endpoint then type
+     */
+    std::vector<TransferSummary> snapshot() const;
+
+    void reset();
+
+private:
+    TransferSummary& summaryLocked(const std::string& endpoint, const std::string& type);
+
+    mutable std::mutex mutex_;
+    std::map<std::pair<std::string, std::string>, TransferSummary> summaries_;
+};
+
+} // namespace hyperliquid
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include <optional>
@@ -25,19 +28,63 @@ struct Signature {
 };
 
 /**
- * Client Order ID - 16-byte hex string with "0x" prefix
+ * Client Order ID - 128-bit value, sent on the wire as "0x" + 32 hex chars
  */
 class Cloid {
 public:
+    static constexpr size_t RAW_LENGTH = 34;
+
     explicit Cloid(const std::string& raw);
+    Cloid(uint64_t hi, uint64_t lo) : hi_(hi), lo_(lo) {}
     static Cloid fromInt(uint64_t value);
     static Cloid fromStr(const std::string& hex);
 
-    std::string toRaw() const { return raw_cloid_; }
+    /**
+     * Wire representation ("0x" + 32 lowercase hex chars)
+     */
+    std::string toRaw() const;
+
+    /**
+     * Write the wire representation into out (RAW_LENGTH chars, not null-terminated)
+     */
+    void toRaw(char* out) const;
+
+    uint64_t hi() const { return hi_; }
+    uint64_t lo() const { return lo_; }
+
+    bool operator==(const Cloid& other) const { return hi_ == other.hi_ && lo_ == other.lo_; }
+    bool operator!=(const Cloid& other) const { return !(*this == other); }
+    bool operator<(const Cloid& other) const {
+        return hi_ != other.hi_ ? hi_ < other.hi_ : lo_ < other.lo_;
+    }
 
 private:
-    void validate();
-    std::string raw_cloid_;
+    uint64_t hi_;
+    uint64_t lo_;
+};
+
+/**
+ * Monotonic, per-process unique Cloid generator
+ *
+ * The high 64 bits hold a per-process prefix (start time in ms and random
+ * bits); the low 64 bits are an atomic counter. Successive cloids from one
+ * generator are strictly increasing and never repeat.
+ */
+class CloidGenerator {
+public:
+    CloidGenerator();
+    explicit CloidGenerator(uint64_t prefix) : prefix_(prefix), counter_(0) {}
+
+    Cloid next() { return Cloid(prefix_, counter_.fetch_add(1, std::memory_order_relaxed)); }
+
+    /**
+     * Process-wide shared generator
+     */
+    static CloidGenerator& global();
+
+private:
+    uint64_t prefix_;
+    std::atomic<uint64_t> counter_;
 };
 
 /**
@@ -201,3 +248,19 @@ struct EIP712Type {
 };
 
 } // namespace hyperliquid
+
+namespace std {
+
+template <>
+struct hash<hyperliquid::Cloid> {
+    size_t operator()(const hyperliquid::Cloid& cloid) const noexcept {
+        // Mix both halves so sequential generator output spreads across buckets
+        uint64_t h = cloid.hi() * 0x9e3779b97f4a7c15ULL ^ cloid.lo();
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+};
+
+} // namespace std
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -63,4 +64,33 @@ double roundPrice(double price, int sz_decimals, bool is_spot);
  */
 double roundSize(double size, int sz_decimals);
 
+/**
+ * Fixed-point scale for prices and sizes (8 decimals, matches wire precision)
+ */
+constexpr int64_t FIXED_POINT_SCALE = 100000000;
+
+/**
+ * Parse a decimal string (e.g. "1234.5") into 8-decimal fixed-point
+ * Digits beyond the 8th decimal place are truncated; throws
+ * std::out_of_range above about 9.2e10
+ */
+int64_t decimalToFixed(std::string_view value);
+
+/**
+ * Convert double to 8-decimal fixed-point (rounded to nearest)
+ * Throws std::out_of_range if the result does not fit
+ */
+int64_t doubleToFixed(double value);
+
+/**
+ * Convert a whole number to 8-decimal fixed-point
+ * Throws std::out_of_range if the result does not fit
+ */
+int64_t integerToFixed(int64_t value);
+
+/**
+ * Convert 8-decimal fixed-point to double
+ */
+double fixedToDouble(int64_t value);
+
 } // namespace hyperliquid
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace hyperliquid {
+
+/**
+ * Incremental splitter for a response body that is a JSON array of objects
+ *
+ * Bytes are fed as they arrive; each top-level element is handed to the
+ * callback as one complete object once its closing brace is seen. Only
+ * the current element is buffered, so memory stays bounded however large
+ * the array. Elements are not validated here; parse them with a SAX
+ * handler in the callback.
+ */
+class ObjectArrayStream {
+public:
+    using ObjectCallback = std::function<void(std::string_view object)>;
+
+    explicit ObjectArrayStream(ObjectCallback on_object);
+
+    /**
+     * Consume the next chunk of the body
+     */
+    void feed(const char* data, size_t len);
+
+    /**
+     * Check the body was a complete array; throws otherwise
+     */
+    void finish();
+
+    size_t count() const { return count_; }
+
+private:
+    ObjectCallback on_object_;
+
+    std::string object_;   // bytes of the element currently being read
+    int depth_ = 0;
+    bool started_ = false;
+    bool in_string_ = false;
+    bool escaped_ = false;
+    bool done_ = false;
+    size_t count_ = 0;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "hyperliquid/types.hpp"
+#include <optional>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+/**
+ * Append the compact JSON encoding of a value to out
+ *
+ * Output is byte-identical to nlohmann::json(value).dump(): object keys
+ * are written in sorted order at every level, whatever the insertion
+ * order of an ordered_json.
+ */
+void appendJson(std::string& out, const nlohmann::json& value);
+void appendJson(std::string& out, const nlohmann::ordered_json& value);
+
+/**
+ * Append a quoted, escaped JSON string to out
+ */
+void appendJsonString(std::string& out, std::string_view value);
+
+/**
+ * Write the signed /exchange request body into out (cleared first)
+ *
+ * Produces the same bytes as dumping the equivalent nlohmann::json
+ * payload, without building it: {"action",...,"expiresAfter",...,
+ * "nonce",...,"signature",...[,"vaultAddress",...]}. vaultAddress is
+ * omitted when include_vault is false and written as null when
+ * vault_address is empty.
+ */
+void writeExchangePayload(std::string& out,
+                          const nlohmann::json& action,
+                          const Signature& signature,
+                          int64_t nonce,
+                          bool include_vault,
+                          const std::string& vault_address,
+                          std::optional<int64_t> expires_after);
+
+void writeExchangePayload(std::string& out,
+                          const nlohmann::ordered_json& action,
+                          const Signature& signature,
+                          int64_t nonce,
+                          bool include_vault,
+                          const std::string& vault_address,
+                          std::optional<int64_t> expires_after);
+
+} // namespace hyperliquid
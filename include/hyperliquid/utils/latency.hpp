@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * Instrumented phases of the request path
+ *
+ * Phases nest: EIP-712 encoding includes its keccak hashes, and signing an
+ * order includes msgpack, keccak, EIP-712 and ECDSA.
+ */
+enum class LatencyPhase {
+    NameResolution,  // Info::nameToAsset
+    Rounding,        // roundPrice / roundSize
+    Msgpack,         // packAction
+    Keccak,          // crypto::keccak256
+    Eip712,          // crypto::encodeTypedData
+    Ecdsa,           // crypto::signHash
+    JsonDump,        // request body serialization
+    CurlPerform,     // curl_easy_perform
+    JsonParse,       // response body parsing
+    Count
+};
+
+constexpr size_t LATENCY_PHASE_COUNT = static_cast<size_t>(LatencyPhase::Count);
+
+const char* latencyPhaseName(LatencyPhase phase);
+
+/**
+ * HDR-style log-linear histogram of nanosecond values
+ *
+ * Values are kept to within 1/64 (~1.6%) of their true value up to
+ * LatencyHistogram::MAX_VALUE_NS; larger values are clamped to it.
+ */
+class LatencyHistogram {
+public:
+    static constexpr int SUB_BUCKET_BITS = 7;
+    static constexpr int MAX_VALUE_BITS = 36;
+    static constexpr int64_t MAX_VALUE_NS = (int64_t{1} << MAX_VALUE_BITS) - 1;  // ~68 s
+    static constexpr size_t BUCKET_COUNT =
+        (size_t{1} << SUB_BUCKET_BITS) +
+        static_cast<size_t>(MAX_VALUE_BITS - SUB_BUCKET_BITS) * (size_t{1} << (SUB_BUCKET_BITS - 1));
+
+    void record(int64_t value_ns, uint64_t count = 1);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    uint64_t count() const { return count_; }
+    int64_t min() const { return count_ == 0 ? 0 : min_; }
+    int64_t max() const { return max_; }
+    double mean() const;
+
+    /**
+     * Value at quantile q (0..1), e.g. 0.99 for p99
+     */
+    int64_t percentile(double q) const;
+
+    static size_t bucketIndex(int64_t value_ns);
+    static int64_t bucketValue(size_t index);
+
+private:
+    std::vector<uint64_t> counts_;  // allocated on first record
+    uint64_t count_ = 0;
+    int64_t sum_ = 0;
+    int64_t min_ = 0;
+    int64_t max_ = 0;
+};
+
+/**
+ * Per-phase histograms merged across every thread that has recorded
+ */
+struct LatencySnapshot {
+    std::array<LatencyHistogram, LATENCY_PHASE_COUNT> phases;
+
+    const LatencyHistogram& operator[](LatencyPhase phase) const {
+        return phases[static_cast<size_t>(phase)];
+    }
+};
+
+/**
+ * True when the library was built with HYPERLIQUID_ENABLE_LATENCY
+ */
+constexpr bool latencyEnabled() {
+#ifdef HYPERLIQUID_ENABLE_LATENCY
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * Record one sample into the calling thread's histogram (lock-free)
+ */
+void recordLatency(LatencyPhase phase, int64_t value_ns);
+
+/**
+ * Merge all per-thread histograms (empty if nothing was recorded, which is
+ * always the case when the library is built without instrumentation)
+ */
+LatencySnapshot latencySnapshot();
+
+/**
+ * Clear all per-thread histograms
+ */
+void resetLatency();
+
+/**
+ * Records the lifetime of the enclosing scope under a phase
+ */
+class LatencyScope {
+public:
+    explicit LatencyScope(LatencyPhase phase)
+        : phase_(phase), start_(std::chrono::steady_clock::now()) {}
+
+    ~LatencyScope() {
+        recordLatency(phase_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start_).count());
+    }
+
+    LatencyScope(const LatencyScope&) = delete;
+    LatencyScope& operator=(const LatencyScope&) = delete;
+
+private:
+    LatencyPhase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace hyperliquid
+
+/**
+ * Time the rest of the enclosing scope, e.g. HYPERLIQUID_LATENCY_SCOPE(Keccak);
+ * expands to nothing unless HYPERLIQUID_ENABLE_LATENCY is defined
+ */
+#ifdef HYPERLIQUID_ENABLE_LATENCY
+#define HYPERLIQUID_LATENCY_CONCAT_(a, b) a##b
+#define HYPERLIQUID_LATENCY_CONCAT(a, b) HYPERLIQUID_LATENCY_CONCAT_(a, b)
+#define HYPERLIQUID_LATENCY_SCOPE(phase)                                          \
+    ::hyperliquid::LatencyScope HYPERLIQUID_LATENCY_CONCAT(latency_scope_, __LINE__)( \
+        ::hyperliquid::LatencyPhase::phase)
+#else
+#define HYPERLIQUID_LATENCY_SCOPE(phase) static_cast<void>(0)
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace hyperliquid {
+
+/**
+ * Strictly increasing nonce allocator for signed actions
+ *
+ * Each nonce is max(now_ms, last + 1), claimed with a lock-free CAS, so
+ * many actions per millisecond or from several threads never collide.
+ * If the wall clock steps backwards, nonces keep counting up from the
+ * last one issued until the clock catches up.
+ *
+ * The counter either lives in the process or in a POSIX shared-memory
+ * segment named after the signing address, so several processes sharing
+ * one key can draw from the same sequence.
+ */
+class NonceManager {
+public:
+    /**
+     * Process-local counter
+     */
+    NonceManager();
+    ~NonceManager();
+
+    NonceManager(const NonceManager&) = delete;
+    NonceManager& operator=(const NonceManager&) = delete;
+
+    /**
+     * Allocate the next nonce
+     */
+    int64_t next();
+
+    /**
+     * Last nonce handed out (0 if none)
+     */
+    int64_t last() const;
+
+    /**
+     * Process-wide manager shared by every Exchange signing with this address
+     */
+    static std::shared_ptr<NonceManager> forAddress(const std::string& address);
+
+    /**
+     * Manager backed by a shared-memory counter, coordinated across processes
+     * signing with the same address
+     */
+    static std::shared_ptr<NonceManager> sharedMemory(const std::string& address);
+
+private:
+    explicit NonceManager(const std::string& shm_name);
+
+    std::atomic<int64_t> local_;
+    std::atomic<int64_t>* counter_;  // &local_ or a shared-memory mapping
+    void* mapping_;
+};
+
+} // namespace hyperliquid
@@ -47,6 +47,17 @@ Signature signL1Action(const Wallet& wallet,
                       std::optional<int64_t> expires_after,
                       bool is_mainnet);
 
+/**
+ * Sign an L1 action whose msgpack encoding is already available
+ * (see packAction); skips re-encoding the action
+ */
+Signature signL1ActionPacked(const Wallet& wallet,
+                             const std::string& packed_action,
+                             const std::optional<std::string>& vault_address,
+                             int64_t nonce,
+                             std::optional<int64_t> expires_after,
+                             bool is_mainnet);
+
 /**
  * Sign a user-signed action (transfers, etc.) using EIP-712
  */
@@ -65,6 +76,24 @@ std::vector<uint8_t> actionHash(const nlohmann::ordered_json& action,
                                 int64_t nonce,
                                 std::optional<int64_t> expires_after);
 
+/**
+ * Compute action hash from an already msgpack-encoded action
+ */
+std::vector<uint8_t> actionHashPacked(const std::string& packed_action,
+                                      const std::optional<std::string>& vault_address,
+                                      int64_t nonce,
+                                      std::optional<int64_t> expires_after);
+
+/**
+ * Msgpack-encode an action, preserving key insertion order
+ */
+std::string packAction(const nlohmann::ordered_json& action);
+
+/**
+ * Append the msgpack encoding of a string (header + bytes) to out
+ */
+void appendMsgpackString(std::string& out, const std::string& value);
+
 /**
  * Construct phantom agent for L1 action signing
  */
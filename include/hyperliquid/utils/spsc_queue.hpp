@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+
+/**
+ * Bounded lock-free single-producer / single-consumer ring buffer
+ *
+ * Exactly one thread may call tryPush() and exactly one thread may call
+ * tryPop(). T must be default-constructible and move-assignable.
+ */
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : slots_(roundUpPowerOfTwo(capacity + 1)), mask_(slots_.size() - 1) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SpscQueue capacity must be positive");
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * Move value in if there is room; value is left untouched when full
+     */
+    bool tryPush(T&& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t next = (tail + 1) & mask_;
+        if (next == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        slots_[tail] = std::move(value);
+        tail_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Move the oldest value out if there is one
+     */
+    bool tryPop(T& out) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = std::move(slots_[head]);
+        slots_[head] = T();
+        head_.store((head + 1) & mask_, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    bool full() const {
+        size_t next = (tail_.load(std::memory_order_acquire) + 1) & mask_;
+        return next == head_.load(std::memory_order_acquire);
+    }
+
+private:
+    static size_t roundUpPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    std::vector<T> slots_;
+    size_t mask_;
+
+    // Producer and consumer indexes on separate cache lines
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace hyperliquid {
+
+/**
+ * Interns short strings (coin names, fee tokens) as dense 32-bit ids
+ *
+ * Ids are assigned in first-seen order starting at 0 and stay valid for
+ * the lifetime of the table. Not thread-safe.
+ */
+class SymbolTable {
+public:
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    /**
+     * Id for name, adding it if not yet present
+     */
+    uint32_t intern(std::string_view name);
+
+    /**
+     * Id for name if present
+     */
+    bool find(std::string_view name, uint32_t& id) const;
+
+    /**
+     * Name for an id returned by intern()
+     */
+    const std::string& name(uint32_t id) const;
+
+    size_t size() const { return names_.size(); }
+
+private:
+    std::deque<std::string> names_;  // stable storage backing the index keys
+    std::unordered_map<std::string_view, uint32_t> ids_;
+};
+
+} // namespace hyperliquid
@@ -0,0 +1,308 @@
+#include "hyperliquid/account_snapshot.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <array>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+namespace {
+
+enum class AccountKey {
+    Other,
+    Coin,
+    Side,
+    LimitPx,
+    Sz,
+    OrigSz,
+    Oid,
+    Cloid,
+    Timestamp,
+    Balances,
+    Token,
+    Total,
+    Hold,
+    EntryNtl
+};
+
+AccountKey keyFor(const std::string& key) {
+    static const std::unordered_map<std::string, AccountKey> keys = {
+        {"coin", AccountKey::Coin},
+        {"side", AccountKey::Side},
+        {"limitPx", AccountKey::LimitPx},
+        {"sz", AccountKey::Sz},
+        {"origSz", AccountKey::OrigSz},
+        {"oid", AccountKey::Oid},
+        {"cloid", AccountKey::Cloid},
+        {"timestamp", AccountKey::Timestamp},
+        {"balances", AccountKey::Balances},
+        {"token", AccountKey::Token},
+        {"total", AccountKey::Total},
+        {"hold", AccountKey::Hold},
+        {"entryNtl", AccountKey::EntryNtl}
+    };
+    auto it = keys.find(key);
+    return it == keys.end() ? AccountKey::Other : it->second;
+}
+
+constexpr size_t MAX_TRACKED_DEPTH = 4;
+
+/**
+ * Key tracking shared by the handlers below; subclasses decode values
+ */
+class AccountHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        enter();
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = keyFor(value);
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        enter();
+        return true;
+    }
+
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error_ = ex.what();
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+protected:
+    AccountKey keyAt(int depth) const { return keys_[depth]; }
+
+    int depth_ = 0;
+
+private:
+    void enter() {
+        ++depth_;
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = AccountKey::Other;
+        }
+    }
+
+    std::array<AccountKey, MAX_TRACKED_DEPTH> keys_{};
+    std::string error_;
+};
+
+// openOrders: [ {"coin", "side", "limitPx", "sz", "oid", ...}, ... ]
+constexpr int ORDER_DEPTH = 2;
+
+class OpenOrdersHandler : public AccountHandler {
+public:
+    OpenOrdersHandler(const std::unordered_map<std::string, int>& coin_to_asset,
+                      std::vector<OpenOrder>& orders)
+        : coin_to_asset_(coin_to_asset), orders_(orders) {}
+
+    bool number_integer(number_integer_t value) override {
+        setInteger(value);
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setInteger(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = doubleToFixed(value);
+        }
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        if (depth_ != ORDER_DEPTH) {
+            return true;
+        }
+        if (int64_t* target = fixedTarget()) {
+            *target = decimalToFixed(value);
+            return true;
+        }
+        OpenOrder& order = orders_.back();
+        switch (keyAt(ORDER_DEPTH)) {
+            case AccountKey::Coin: {
+                auto it = coin_to_asset_.find(value);
+                order.asset = it == coin_to_asset_.end() ? -1 : it->second;
+                break;
+            }
+            case AccountKey::Side:
+                order.is_buy = value == "B";
+                break;
+            case AccountKey::Cloid:
+                order.cloid = Cloid(value);
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t elements) override {
+        AccountHandler::start_object(elements);
+        if (depth_ == ORDER_DEPTH) {
+            orders_.emplace_back();
+            has_orig_sz_ = false;
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        if (depth_ == ORDER_DEPTH && !has_orig_sz_) {
+            orders_.back().orig_sz = orders_.back().sz;
+        }
+        return AccountHandler::end_object();
+    }
+
+private:
+    int64_t* fixedTarget() {
+        if (depth_ != ORDER_DEPTH) {
+            return nullptr;
+        }
+        OpenOrder& order = orders_.back();
+        switch (keyAt(ORDER_DEPTH)) {
+            case AccountKey::LimitPx: return &order.limit_px;
+            case AccountKey::Sz: return &order.sz;
+            case AccountKey::OrigSz:
+                has_orig_sz_ = true;
+                return &order.orig_sz;
+            default: return nullptr;
+        }
+    }
+
+    void setInteger(int64_t value) {
+        if (depth_ != ORDER_DEPTH) {
+            return;
+        }
+        OpenOrder& order = orders_.back();
+        if (keyAt(ORDER_DEPTH) == AccountKey::Oid) {
+            order.oid = value;
+        } else if (keyAt(ORDER_DEPTH) == AccountKey::Timestamp) {
+            order.timestamp = value;
+        } else if (int64_t* target = fixedTarget()) {
+            *target = integerToFixed(value);
+        }
+    }
+
+    const std::unordered_map<std::string, int>& coin_to_asset_;
+    std::vector<OpenOrder>& orders_;
+    bool has_orig_sz_ = false;
+};
+
+// spotClearinghouseState: {"balances": [ {"coin", "token", "total", "hold", "entryNtl"}, ... ]}
+constexpr int BALANCE_DEPTH = 3;
+
+class SpotBalancesHandler : public AccountHandler {
+public:
+    explicit SpotBalancesHandler(std::vector<SpotBalance>& balances) : balances_(balances) {}
+
+    bool number_integer(number_integer_t value) override {
+        setInteger(value);
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setInteger(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = doubleToFixed(value);
+        }
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = decimalToFixed(value);
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t elements) override {
+        AccountHandler::start_object(elements);
+        if (inBalance()) {
+            balances_.emplace_back();
+        }
+        return true;
+    }
+
+private:
+    bool inBalance() const {
+        return depth_ == BALANCE_DEPTH && keyAt(1) == AccountKey::Balances;
+    }
+
+    int64_t* fixedTarget() {
+        if (!inBalance()) {
+            return nullptr;
+        }
+        SpotBalance& balance = balances_.back();
+        switch (keyAt(BALANCE_DEPTH)) {
+            case AccountKey::Total: return &balance.total;
+            case AccountKey::Hold: return &balance.hold;
+            case AccountKey::EntryNtl: return &balance.entry_ntl;
+            default: return nullptr;
+        }
+    }
+
+    void setInteger(int64_t value) {
+        if (inBalance() && keyAt(BALANCE_DEPTH) == AccountKey::Token) {
+            balances_.back().token = static_cast<int>(value);
+        } else if (int64_t* target = fixedTarget()) {
+            *target = integerToFixed(value);
+        }
+    }
+
+    std::vector<SpotBalance>& balances_;
+};
+
+} // namespace
+
+void AccountSnapshot::clear() {
+    state.clear();
+    open_orders.clear();
+    spot_balances.clear();
+}
+
+void parseOpenOrders(std::string_view body,
+                     const std::unordered_map<std::string, int>& coin_to_asset,
+                     std::vector<OpenOrder>& orders) {
+    orders.clear();
+    OpenOrdersHandler handler(coin_to_asset, orders);
+    if (!nlohmann::json::sax_parse(body.begin(), body.end(), &handler)) {
+        throw std::runtime_error("Failed to parse openOrders: " + handler.error());
+    }
+}
+
+void parseSpotBalances(std::string_view body, std::vector<SpotBalance>& balances) {
+    balances.clear();
+    SpotBalancesHandler handler(balances);
+    if (!nlohmann::json::sax_parse(body.begin(), body.end(), &handler)) {
+        throw std::runtime_error("Failed to parse spotClearinghouseState: " + handler.error());
+    }
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,337 @@
+#include "hyperliquid/action_response.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <array>
+#include <stdexcept>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+namespace {
+
+enum class ResponseKey {
+    Other,
+    Status,
+    Response,
+    Type,
+    Data,
+    Statuses,
+    Resting,
+    Filled,
+    Error,
+    Oid,
+    Cloid,
+    TotalSz,
+    AvgPx
+};
+
+ResponseKey keyFor(const std::string& key) {
+    static const std::unordered_map<std::string, ResponseKey> keys = {
+        {"status", ResponseKey::Status},
+        {"response", ResponseKey::Response},
+        {"type", ResponseKey::Type},
+        {"data", ResponseKey::Data},
+        {"statuses", ResponseKey::Statuses},
+        {"resting", ResponseKey::Resting},
+        {"filled", ResponseKey::Filled},
+        {"error", ResponseKey::Error},
+        {"oid", ResponseKey::Oid},
+        {"cloid", ResponseKey::Cloid},
+        {"totalSz", ResponseKey::TotalSz},
+        {"avgPx", ResponseKey::AvgPx}
+    };
+    auto it = keys.find(key);
+    return it == keys.end() ? ResponseKey::Other : it->second;
+}
+
+// Nesting of the values we decode:
+//   1 {"status", "response"}
+//   2   {"type", "data"}
+//   3     {"statuses"}
+//   4       [ "success" | {...} ]
+//   5         {"resting" | "filled" | "error"}
+//   6           {"oid", "cloid", "totalSz", "avgPx"}
+constexpr int STATUS_ARRAY_DEPTH = 4;
+constexpr int STATUS_DEPTH = 5;
+constexpr int STATUS_FIELD_DEPTH = 6;
+constexpr size_t MAX_TRACKED_DEPTH = 7;
+
+/**
+ * SAX handler filling an ActionResponse; anything outside the paths
+ * above is skipped
+ */
+class ActionResponseHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    explicit ActionResponseHandler(ActionResponse& result) : result_(result) {}
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+
+    bool number_integer(number_integer_t value) override {
+        setInteger(value);
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setInteger(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = doubleToFixed(value);
+        }
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        if (depth_ == 1) {
+            if (keyAt(1) == ResponseKey::Status) {
+                result_.ok = value == "ok";
+            } else if (keyAt(1) == ResponseKey::Response) {
+                // Rejected actions carry the reason as a bare string
+                result_.error = std::move(value);
+            }
+        } else if (depth_ == 2 && inResponse() && keyAt(2) == ResponseKey::Type) {
+            result_.type = std::move(value);
+        } else if (depth_ == STATUS_ARRAY_DEPTH && inStatuses()) {
+            result_.statuses.emplace_back(AckStatus{std::move(value)});
+        } else if (depth_ == STATUS_DEPTH && inStatuses() && keyAt(STATUS_DEPTH) == ResponseKey::Error) {
+            result_.statuses.back() = ErrorStatus{std::move(value)};
+        } else if (depth_ == STATUS_FIELD_DEPTH && inStatuses()) {
+            if (int64_t* target = fixedTarget()) {
+                *target = decimalToFixed(value);
+            } else if (keyAt(STATUS_FIELD_DEPTH) == ResponseKey::Cloid) {
+                setCloid(Cloid(value));
+            }
+        }
+        return true;
+    }
+
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        ++depth_;
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = ResponseKey::Other;
+        }
+        if (depth_ == STATUS_DEPTH && inStatuses()) {
+            // Replaced once the "resting" / "filled" / "error" key is seen
+            result_.statuses.emplace_back(AckStatus{});
+        }
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        if (static_cast<size_t>(depth_) >= MAX_TRACKED_DEPTH) {
+            return true;
+        }
+        ResponseKey key = keyFor(value);
+        keys_[depth_] = key;
+        if (depth_ == STATUS_DEPTH && inStatuses()) {
+            if (key == ResponseKey::Resting) {
+                result_.statuses.back() = RestingStatus{};
+            } else if (key == ResponseKey::Filled) {
+                result_.statuses.back() = FilledStatus{};
+            } else if (key == ResponseKey::Error) {
+                result_.statuses.back() = ErrorStatus{};
+            }
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        ++depth_;
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = ResponseKey::Other;
+        }
+        return true;
+    }
+
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error_ = ex.what();
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    ResponseKey keyAt(int depth) const { return keys_[depth]; }
+
+    bool inResponse() const { return keyAt(1) == ResponseKey::Response; }
+
+    bool inStatuses() const {
+        return depth_ >= STATUS_ARRAY_DEPTH && inResponse() &&
+               keyAt(2) == ResponseKey::Data && keyAt(3) == ResponseKey::Statuses;
+    }
+
+    int64_t* fixedTarget() {
+        if (depth_ != STATUS_FIELD_DEPTH || !inStatuses()) {
+            return nullptr;
+        }
+        auto* filled = std::get_if<FilledStatus>(&result_.statuses.back());
+        if (!filled) {
+            return nullptr;
+        }
+        switch (keyAt(STATUS_FIELD_DEPTH)) {
+            case ResponseKey::TotalSz: return &filled->total_sz;
+            case ResponseKey::AvgPx: return &filled->avg_px;
+            default: return nullptr;
+        }
+    }
+
+    void setInteger(int64_t value) {
+        if (depth_ != STATUS_FIELD_DEPTH || !inStatuses()) {
+            return;
+        }
+        OrderStatus& status = result_.statuses.back();
+        if (keyAt(STATUS_FIELD_DEPTH) == ResponseKey::Oid) {
+            if (auto* resting = std::get_if<RestingStatus>(&status)) {
+                resting->oid = value;
+            } else if (auto* filled = std::get_if<FilledStatus>(&status)) {
+                filled->oid = value;
+            }
+        } else if (int64_t* target = fixedTarget()) {
+            *target = integerToFixed(value);
+        }
+    }
+
+    void setCloid(Cloid cloid) {
+        OrderStatus& status = result_.statuses.back();
+        if (auto* resting = std::get_if<RestingStatus>(&status)) {
+            resting->cloid = cloid;
+        } else if (auto* filled = std::get_if<FilledStatus>(&status)) {
+            filled->cloid = cloid;
+        }
+    }
+
+    ActionResponse& result_;
+    std::array<ResponseKey, MAX_TRACKED_DEPTH> keys_{};
+    int depth_ = 0;
+    std::string error_;
+};
+
+/**
+ * Fixed-point value of a "totalSz" / "avgPx" field, sent as a decimal string
+ */
+int64_t fixedField(const nlohmann::json& value) {
+    if (value.is_string()) {
+        return decimalToFixed(value.get_ref<const std::string&>());
+    }
+    if (value.is_number_integer()) {
+        return integerToFixed(value.get<int64_t>());
+    }
+    return value.is_number() ? doubleToFixed(value.get<double>()) : 0;
+}
+
+template <typename Status>
+void readOrderFields(const nlohmann::json& fields, Status& status) {
+    if (!fields.is_object()) {
+        return;
+    }
+    auto oid = fields.find("oid");
+    if (oid != fields.end() && oid->is_number_integer()) {
+        status.oid = oid->get<int64_t>();
+    }
+    auto cloid = fields.find("cloid");
+    if (cloid != fields.end() && cloid->is_string()) {
+        status.cloid = Cloid(cloid->get<std::string>());
+    }
+}
+
+OrderStatus statusFromJson(const nlohmann::json& item) {
+    if (item.is_string()) {
+        return AckStatus{item.get<std::string>()};
+    }
+    if (!item.is_object()) {
+        return AckStatus{};
+    }
+    auto resting = item.find("resting");
+    if (resting != item.end()) {
+        RestingStatus status;
+        readOrderFields(*resting, status);
+        return status;
+    }
+    auto filled = item.find("filled");
+    if (filled != item.end()) {
+        FilledStatus status;
+        readOrderFields(*filled, status);
+        if (filled->is_object()) {
+            status.total_sz = fixedField(filled->value("totalSz", nlohmann::json()));
+            status.avg_px = fixedField(filled->value("avgPx", nlohmann::json()));
+        }
+        return status;
+    }
+    auto error = item.find("error");
+    if (error != item.end()) {
+        return ErrorStatus{error->is_string() ? error->get<std::string>() : std::string()};
+    }
+    return AckStatus{};
+}
+
+} // namespace
+
+void ActionResponse::clear() {
+    ok = false;
+    type.clear();
+    error.clear();
+    statuses.clear();
+}
+
+void parseActionResponse(std::string_view body, ActionResponse& result) {
+    result.clear();
+    ActionResponseHandler handler(result);
+    if (!nlohmann::json::sax_parse(body.begin(), body.end(), &handler)) {
+        throw std::runtime_error("Failed to parse action response: " + handler.error());
+    }
+}
+
+void actionResponseFromJson(const nlohmann::json& body, ActionResponse& result) {
+    result.clear();
+    if (!body.is_object()) {
+        return;
+    }
+    auto status = body.find("status");
+    result.ok = status != body.end() && status->is_string() && *status == "ok";
+
+    auto response = body.find("response");
+    if (response == body.end()) {
+        return;
+    }
+    if (response->is_string()) {
+        // Rejected actions carry the reason as a bare string
+        result.error = response->get<std::string>();
+        return;
+    }
+    if (!response->is_object()) {
+        return;
+    }
+    auto type = response->find("type");
+    if (type != response->end() && type->is_string()) {
+        result.type = type->get<std::string>();
+    }
+    auto data = response->find("data");
+    if (data == response->end() || !data->is_object()) {
+        return;
+    }
+    auto statuses = data->find("statuses");
+    if (statuses == data->end() || !statuses->is_array()) {
+        return;
+    }
+    result.statuses.reserve(statuses->size());
+    for (const auto& item : *statuses) {
+        result.statuses.push_back(statusFromJson(item));
+    }
+}
+
+} // namespace hyperliquid
@@ -1,9 +1,15 @@
 #include "hyperliquid/api.hpp"
 #include "hyperliquid/errors.hpp"
 #include "hyperliquid/utils/constants.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <curl/curl.h>
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <random>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 
 namespace hyperliquid {
 
@@ -17,7 +23,11 @@ size_t API::writeCallback(void* contents, size_t size, size_t nmemb, void* userp
 API::API(const std::string& base_url, int timeout_ms)
     : base_url_(base_url.empty() ? MAINNET_API_URL : base_url),
       timeout_ms_(timeout_ms),
-      curl_handle_(nullptr) {
+      curl_handle_(nullptr),
+      multi_handle_(nullptr),
+      hedge_handles_{nullptr, nullptr},
+      transfer_stats_(std::make_shared<TransferStats>()),
+      rate_limiter_(std::make_shared<RateLimiter>()) {
     initCurl();
 }
 
@@ -33,12 +43,200 @@ void API::initCurl() {
 }
 
 void API::cleanupCurl() {
+    for (auto& handle : hedge_handles_) {
+        if (handle) {
+            curl_easy_cleanup(static_cast<CURL*>(handle));
+            handle = nullptr;
+        }
+    }
+    if (multi_handle_) {
+        curl_multi_cleanup(static_cast<CURLM*>(multi_handle_));
+        multi_handle_ = nullptr;
+    }
     if (curl_handle_) {
         curl_easy_cleanup(static_cast<CURL*>(curl_handle_));
         curl_handle_ = nullptr;
     }
 }
 
+void API::setTransferStats(std::shared_ptr<TransferStats> stats) {
+    if (!stats) {
+        throw std::invalid_argument("Transfer stats must not be null");
+    }
+    transfer_stats_ = std::move(stats);
+}
+
+void API::setRateLimiter(std::shared_ptr<RateLimiter> limiter) {
+    rate_limiter_ = std::move(limiter);
+}
+
+void API::setRetryPolicy(const RetryPolicy& policy) {
+    if (policy.max_attempts < 1) {
+        throw std::invalid_argument("RetryPolicy max_attempts must be at least 1");
+    }
+    if (policy.hedge_quantile <= 0.0 || policy.hedge_quantile > 1.0) {
+        throw std::invalid_argument("RetryPolicy hedge_quantile must be in (0, 1]");
+    }
+    retry_policy_ = policy;
+}
+
+void API::acquireWeight(const std::string& url_path,
+                        const std::string& request_type,
+                        size_t batch_length) {
+    if (rate_limiter_) {
+        rate_limiter_->acquire(RateLimiter::requestWeight(url_path, request_type, batch_length),
+                               RateLimiter::laneFor(request_type));
+    }
+}
+
+void API::updateRateLimit(void* handle, long response_code) {
+    if (!rate_limiter_) {
+        return;
+    }
+    if (response_code == 429) {
+        curl_off_t retry_after = 0;
+        curl_easy_getinfo(static_cast<CURL*>(handle), CURLINFO_RETRY_AFTER, &retry_after);
+        rate_limiter_->onRateLimited(std::chrono::seconds(retry_after));
+    } else if (response_code >= 200 && response_code < 300) {
+        rate_limiter_->onSuccess();
+    }
+}
+
+namespace {
+
+/**
+ * The payload's "type" field, used to label transfers
+ */
+std::string requestType(const nlohmann::json& payload) {
+    if (payload.is_object()) {
+        auto it = payload.find("type");
+        if (it != payload.end() && it->is_string()) {
+            return it->get<std::string>();
+        }
+    }
+    return "";
+}
+
+/**
+ * Failures worth retrying: the request may not have reached the server,
+ * or the server did not answer in time
+ */
+bool transientFailure(CURLcode code) {
+    switch (code) {
+        case CURLE_OPERATION_TIMEDOUT:
+        case CURLE_COULDNT_CONNECT:
+        case CURLE_SEND_ERROR:
+        case CURLE_RECV_ERROR:
+        case CURLE_GOT_NOTHING:
+        case CURLE_PARTIAL_FILE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Full jitter: uniform in [0, min(max_backoff, base_backoff * 2^(attempt-1))]
+ */
+std::chrono::milliseconds retryBackoff(const RetryPolicy& policy, int attempt) {
+    thread_local std::mt19937_64 rng{std::random_device{}()};
+    int64_t ceiling = std::min<int64_t>(policy.max_backoff.count(),
+                                        policy.base_backoff.count() << std::min(attempt - 1, 20));
+    std::uniform_int_distribution<int64_t> dist(0, std::max<int64_t>(ceiling, 0));
+    return std::chrono::milliseconds(dist(rng));
+}
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * When a query's attempts and backoffs must have finished; the client
+ * timeout bounds them together, and 0 (no timeout) leaves them unbounded
+ */
+Clock::time_point retryDeadline(int client_timeout_ms) {
+    return client_timeout_ms > 0 ? Clock::now() + std::chrono::milliseconds(client_timeout_ms)
+                                 : Clock::time_point::max();
+}
+
+/**
+ * Timeout for the next attempt: the policy's, cut to what is left before the deadline
+ */
+int attemptTimeout(const RetryPolicy& policy, int client_timeout_ms, Clock::time_point deadline) {
+    int64_t timeout = policy.attempt_timeout_ms > 0 ? policy.attempt_timeout_ms : client_timeout_ms;
+    if (deadline == Clock::time_point::max()) {
+        return static_cast<int>(timeout);
+    }
+    int64_t remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+    if (timeout <= 0 || timeout > remaining) {
+        timeout = remaining;
+    }
+    return static_cast<int>(std::max<int64_t>(timeout, 1));
+}
+
+/**
+ * Hedge once a query is slower than the configured quantile of its history
+ */
+std::chrono::nanoseconds hedgeDelay(const RetryPolicy& policy,
+                                    const TransferStats& stats,
+                                    const std::string& url_path,
+                                    const std::string& request_type) {
+    std::chrono::nanoseconds delay = policy.hedge_default_delay;
+    int64_t quantile_ns = stats.totalPercentile(url_path, request_type, policy.hedge_quantile,
+                                                policy.hedge_min_samples);
+    if (quantile_ns >= 0) {
+        delay = std::chrono::nanoseconds(quantile_ns);
+    }
+    return std::max<std::chrono::nanoseconds>(delay, policy.hedge_min_delay);
+}
+
+int64_t infoMicros(CURL* curl, CURLINFO info) {
+    curl_off_t value = 0;
+    curl_easy_getinfo(curl, info, &value);
+    return static_cast<int64_t>(value);
+}
+
+} // namespace
+
+void API::recordTransfer(void* handle,
+                         const std::string& url_path,
+                         const std::string& request_type,
+                         TransferTiming* last,
+                         int64_t start_offset_us) {
+    CURL* curl = static_cast<CURL*>(handle);
+
+    // curl reports cumulative times from the start of the transfer
+    int64_t name_lookup = infoMicros(curl, CURLINFO_NAMELOOKUP_TIME_T);
+    int64_t connect = infoMicros(curl, CURLINFO_CONNECT_TIME_T);
+    int64_t app_connect = infoMicros(curl, CURLINFO_APPCONNECT_TIME_T);
+    int64_t start_transfer = infoMicros(curl, CURLINFO_STARTTRANSFER_TIME_T);
+
+    TransferTiming timing;
+    timing.endpoint = url_path;
+    timing.type = request_type;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &timing.status);
+    timing.dns_us = name_lookup;
+    timing.connect_us = std::max<int64_t>(0, connect - name_lookup);
+    timing.tls_us = app_connect > 0 ? std::max<int64_t>(0, app_connect - connect) : 0;
+    timing.server_us = std::max<int64_t>(0, start_transfer - std::max(connect, app_connect));
+    timing.ttfb_us = start_offset_us + start_transfer;
+    timing.total_us = start_offset_us + infoMicros(curl, CURLINFO_TOTAL_TIME_T);
+
+    long request_size = 0;
+    long header_size = 0;
+    curl_easy_getinfo(curl, CURLINFO_REQUEST_SIZE, &request_size);
+    curl_easy_getinfo(curl, CURLINFO_HEADER_SIZE, &header_size);
+    timing.bytes_sent = request_size + infoMicros(curl, CURLINFO_SIZE_UPLOAD_T);
+    timing.bytes_received = header_size + infoMicros(curl, CURLINFO_SIZE_DOWNLOAD_T);
+
+    long new_connects = 0;
+    curl_easy_getinfo(curl, CURLINFO_NUM_CONNECTS, &new_connects);
+    timing.reused_connection = new_connects == 0;
+
+    transfer_stats_->record(timing);
+    if (last) {
+        *last = std::move(timing);
+    }
+}
+
 void API::handleException(long response_code, const std::string& response_body) {
     if (response_code >= 200 && response_code < 300) {
         return;  // Success
@@ -53,6 +251,9 @@ void API::handleException(long response_code, const std::string& response_body)
             std::string error_code = json_response.value("error", "Unknown");
             std::string error_message = json_response.value("message", response_body);
             std::string error_data = json_response.value("data", "");
+            if (response_code == 429) {
+                throw RateLimitError(error_code, error_message, error_data);
+            }
             throw ClientError(response_code, error_code, error_message, error_data);
         } else if (response_code >= 500) {
             // Server error
@@ -61,7 +262,9 @@ void API::handleException(long response_code, const std::string& response_body)
         }
     } catch (const nlohmann::json::parse_error&) {
         // Not JSON, use raw response body
-        if (response_code >= 400 && response_code < 500) {
+        if (response_code == 429) {
+            throw RateLimitError("RateLimited", response_body);
+        } else if (response_code >= 400 && response_code < 500) {
             throw ClientError(response_code, "ParseError", response_body);
         } else if (response_code >= 500) {
             throw ServerError(response_code, response_body);
@@ -70,56 +273,736 @@ void API::handleException(long response_code, const std::string& response_body)
 }
 
 nlohmann::json API::post(const std::string& url_path, const nlohmann::json& payload) {
-    CURL* curl = static_cast<CURL*>(curl_handle_);
+    std::string body;
+    {
+        HYPERLIQUID_LATENCY_SCOPE(JsonDump);
+        body = payload.dump();
+    }
+    return postBody(url_path, body, requestType(payload));
+}
+
+nlohmann::json API::postBody(const std::string& url_path,
+                             const std::string& json_str,
+                             const std::string& request_type,
+                             size_t batch_length) {
     std::string response_body;
+    postBodyRaw(url_path, json_str, request_type, batch_length, response_body);
+    return parseBody(response_body);
+}
 
-    std::string url = base_url_ + url_path;
-    std::string json_str = payload.dump();
+void API::postBodyRaw(const std::string& url_path,
+                      const std::string& json_str,
+                      const std::string& request_type,
+                      size_t batch_length,
+                      std::string& response_body) {
+    response_body.clear();
+    long response_code;
+    if (url_path == "/info") {
+        // Queries are idempotent; signed actions are never resent
+        response_code = performIdempotent(url_path, json_str, request_type, response_body);
+    } else {
+        response_code = perform(url_path, json_str, request_type, batch_length,
+                                writeCallback, &response_body);
+    }
+
+    // Handle errors
+    handleException(response_code, response_body);
+}
+
+nlohmann::json API::parseBody(const std::string& response_body) {
+    try {
+        HYPERLIQUID_LATENCY_SCOPE(JsonParse);
+        return nlohmann::json::parse(response_body);
+    } catch (const nlohmann::json::parse_error& e) {
+        throw std::runtime_error(std::string("Failed to parse JSON response: ") + e.what());
+    }
+}
+
+namespace {
+
+struct StreamContext {
+    void* curl;
+    std::function<void(const char*, size_t)> on_data;
+    void** owner = nullptr;  // hedged streams: the handle whose body is passed on
+    bool status_checked = false;
+    bool success = false;
+    bool delivered = false;  // on_data has seen part of the body, so it cannot be requested again
+    std::string error_body;
+    std::exception_ptr error;
+};
+
+} // namespace
+
+size_t API::streamCallback(void* contents, size_t size, size_t nmemb, void* userp) {
+    size_t total_size = size * nmemb;
+    auto* context = static_cast<StreamContext*>(userp);
+
+    if (!context->status_checked) {
+        long response_code = 0;
+        curl_easy_getinfo(static_cast<CURL*>(context->curl), CURLINFO_RESPONSE_CODE, &response_code);
+        context->success = response_code >= 200 && response_code < 300;
+        context->status_checked = true;
+    }
+
+    // Error bodies are collected for handleException, not streamed
+    if (!context->success) {
+        context->error_body.append(static_cast<char*>(contents), total_size);
+        return total_size;
+    }
+
+    // The first request of a hedged pair to start its body wins; the other is aborted
+    if (context->owner) {
+        if (!*context->owner) {
+            *context->owner = context->curl;
+        } else if (*context->owner != context->curl) {
+            return 0;
+        }
+    }
+    context->delivered = true;
+
+    // Exceptions must not unwind through libcurl; abort the transfer instead
+    try {
+        context->on_data(static_cast<char*>(contents), total_size);
+    } catch (...) {
+        context->error = std::current_exception();
+        return 0;
+    }
+    return total_size;
+}
+
+void API::postStream(const std::string& url_path,
+                     const nlohmann::json& payload,
+                     const ChunkCallback& on_data) {
+    std::string body = payload.dump();
+    std::string error_body;
+    long response_code;
+    if (url_path == "/info") {
+        response_code = performIdempotent(url_path, body, requestType(payload), error_body, &on_data);
+    } else {
+        bool delivered = false;
+        response_code = performStream(url_path, body, requestType(payload), timeout_ms_, on_data,
+                                      error_body, delivered);
+    }
+
+    handleException(response_code, error_body);
+}
+
+long API::performStream(const std::string& url_path,
+                        const std::string& body,
+                        const std::string& request_type,
+                        int timeout_ms,
+                        const ChunkCallback& on_data,
+                        std::string& error_body,
+                        bool& delivered) {
+    StreamContext context;
+    context.curl = curl_handle_;
+    context.on_data = on_data;
+
+    long response_code = 0;
+    try {
+        response_code = perform(url_path, body, request_type, 0, streamCallback, &context, timeout_ms);
+    } catch (...) {
+        delivered = context.delivered;
+        if (context.error) {
+            std::rethrow_exception(context.error);
+        }
+        throw;
+    }
+    error_body = std::move(context.error_body);
+    return response_code;
+}
+
+void API::configureRequest(void* handle,
+                           const std::string& url,
+                           const std::string& body,
+                           void* headers,
+                           size_t (*write_fn)(void*, size_t, size_t, void*),
+                           void* write_data,
+                           int timeout_ms) {
+    CURL* curl = static_cast<CURL*>(handle);
 
     // Set URL
     curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
 
     // Set POST data
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, json_str.c_str());
-    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, json_str.length());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDS, body.c_str());
+    curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, body.length());
 
     // Set write callback
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response_body);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_fn);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, write_data);
 
     // Set timeout
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(timeout_ms_));
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, static_cast<long>(timeout_ms));
 
     // Set headers
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, static_cast<struct curl_slist*>(headers));
+}
+
+long API::perform(const std::string& url_path,
+                  const std::string& body,
+                  const std::string& request_type,
+                  size_t batch_length,
+                  size_t (*write_fn)(void*, size_t, size_t, void*),
+                  void* write_data,
+                  int timeout_ms) {
+    CURL* curl = static_cast<CURL*>(curl_handle_);
+
+    acquireWeight(url_path, request_type, batch_length);
+
+    std::string url = base_url_ + url_path;
+
     struct curl_slist* headers = nullptr;
     headers = curl_slist_append(headers, "Content-Type: application/json");
-    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    configureRequest(curl, url, body, headers, write_fn, write_data,
+                     timeout_ms > 0 ? timeout_ms : timeout_ms_);
 
     // Perform request
-    CURLcode res = curl_easy_perform(curl);
+    CURLcode res;
+    {
+        HYPERLIQUID_LATENCY_SCOPE(CurlPerform);
+        res = curl_easy_perform(curl);
+    }
 
     // Clean up headers
     curl_slist_free_all(headers);
 
+    if (res != CURLE_OK && res != CURLE_WRITE_ERROR) {
+        transfer_stats_->recordError(url_path, request_type);
+    } else {
+        recordTransfer(curl, url_path, request_type, &last_transfer_);
+    }
+
     if (res != CURLE_OK) {
         std::string error_msg = "HTTP request failed: ";
         error_msg += curl_easy_strerror(res);
-        throw std::runtime_error(error_msg);
+        throw NetworkError(error_msg, transientFailure(res));
     }
 
     // Get response code
     long response_code;
     curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &response_code);
+    updateRateLimit(curl, response_code);
+    return response_code;
+}
 
-    // Handle errors
-    handleException(response_code, response_body);
+void* API::multiHandle() {
+    if (!multi_handle_) {
+        multi_handle_ = curl_multi_init();
+        if (!multi_handle_) {
+            throw std::runtime_error("Failed to initialize libcurl multi handle");
+        }
+    }
+    return multi_handle_;
+}
 
-    // Parse and return JSON
-    try {
-        return nlohmann::json::parse(response_body);
-    } catch (const nlohmann::json::parse_error& e) {
-        throw std::runtime_error(std::string("Failed to parse JSON response: ") + e.what());
+long API::performIdempotent(const std::string& url_path,
+                            const std::string& body,
+                            const std::string& request_type,
+                            std::string& response_body,
+                            const ChunkCallback* on_data) {
+    Clock::time_point deadline = retryDeadline(timeout_ms_);
+
+    for (int attempt = 1;; ++attempt) {
+        response_body.clear();
+        long response_code = 0;
+        bool delivered = false;
+        std::exception_ptr failure;
+        try {
+            int timeout_ms = attemptTimeout(retry_policy_, timeout_ms_, deadline);
+            if (retry_policy_.hedge) {
+                response_code = performHedged(url_path, body, request_type, response_body, timeout_ms,
+                                              on_data, delivered);
+            } else if (on_data) {
+                response_code = performStream(url_path, body, request_type, timeout_ms, *on_data,
+                                              response_body, delivered);
+            } else {
+                response_code = perform(url_path, body, request_type, 0, writeCallback, &response_body,
+                                        timeout_ms);
+            }
+            if (response_code < 500) {
+                return response_code;
+            }
+        } catch (const NetworkError& e) {
+            if (!e.transient() || delivered) {
+                throw;
+            }
+            failure = std::current_exception();
+        }
+
+        // Give up rather than sleep past the deadline
+        auto backoff = retryBackoff(retry_policy_, attempt);
+        if (attempt >= retry_policy_.max_attempts || Clock::now() + backoff >= deadline) {
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+            return response_code;
+        }
+        transfer_stats_->recordRetry(url_path, request_type);
+        std::this_thread::sleep_for(backoff);
+    }
+}
+
+long API::performHedged(const std::string& url_path,
+                        const std::string& body,
+                        const std::string& request_type,
+                        std::string& response_body,
+                        int timeout_ms,
+                        const ChunkCallback* on_data,
+                        bool& delivered) {
+    CURLM* multi = static_cast<CURLM*>(multiHandle());
+    for (auto& handle : hedge_handles_) {
+        if (!handle) {
+            handle = curl_easy_init();
+            if (!handle) {
+                throw std::runtime_error("Failed to initialize libcurl");
+            }
+        }
+    }
+
+    acquireWeight(url_path, request_type, 0);
+
+    std::chrono::nanoseconds delay = hedgeDelay(retry_policy_, *transfer_stats_, url_path, request_type);
+    std::string url = base_url_ + url_path;
+    struct curl_slist* headers = nullptr;
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+
+    struct Attempt {
+        CURL* curl = nullptr;
+        std::string response;
+        StreamContext context;
+        bool active = false;
+        CURLcode result = CURLE_OK;
+        long response_code = 0;
+        Clock::time_point started;
+        TransferTiming timing;
+    };
+    Attempt attempts[2];
+    size_t launched = 0;
+    void* owner = nullptr;  // streamed: the attempt that started its body first
+    auto launch = [&]() {
+        Attempt& attempt = attempts[launched];
+        attempt.curl = static_cast<CURL*>(hedge_handles_[launched]);
+        if (on_data) {
+            attempt.context.curl = attempt.curl;
+            attempt.context.on_data = *on_data;
+            attempt.context.owner = &owner;
+            configureRequest(attempt.curl, url, body, headers, streamCallback, &attempt.context, timeout_ms);
+        } else {
+            configureRequest(attempt.curl, url, body, headers, writeCallback, &attempt.response, timeout_ms);
+        }
+        curl_multi_add_handle(multi, attempt.curl);
+        attempt.active = true;
+        attempt.started = Clock::now();
+        ++launched;
+    };
+
+    launch();
+    auto hedge_at = Clock::now() + delay;
+    int winner = -1;
+    int finished = 0;
+
+    {
+        HYPERLIQUID_LATENCY_SCOPE(CurlPerform);
+        while (true) {
+            int running = 0;
+            curl_multi_perform(multi, &running);
+
+            CURLMsg* message;
+            int queued;
+            while ((message = curl_multi_info_read(multi, &queued))) {
+                if (message->msg != CURLMSG_DONE) {
+                    continue;
+                }
+                for (size_t i = 0; i < launched; ++i) {
+                    Attempt& attempt = attempts[i];
+                    if (!attempt.active || attempt.curl != message->easy_handle) {
+                        continue;
+                    }
+                    curl_multi_remove_handle(multi, attempt.curl);
+                    attempt.active = false;
+                    attempt.result = message->data.result;
+                    finished = static_cast<int>(i);
+                    if (attempt.result != CURLE_OK) {
+                        // The loser of a hedged stream is aborted on purpose
+                        if (!owner || owner == attempt.curl) {
+                            transfer_stats_->recordError(url_path, request_type);
+                        }
+                        // A stream that has started cannot switch to the other request
+                        if (owner == attempt.curl) {
+                            winner = static_cast<int>(i);
+                        }
+                        break;
+                    }
+                    // The series feeds the hedge delay, so time every answer from the
+                    // original request; a hedge's own time would bias it downwards
+                    auto offset = std::chrono::duration_cast<std::chrono::microseconds>(
+                        attempt.started - attempts[0].started);
+                    recordTransfer(attempt.curl, url_path, request_type, &attempt.timing, offset.count());
+                    curl_easy_getinfo(attempt.curl, CURLINFO_RESPONSE_CODE, &attempt.response_code);
+                    updateRateLimit(attempt.curl, attempt.response_code);
+                    // A 5xx is not an answer while the other request may still succeed
+                    if (winner < 0 && attempt.response_code < 500) {
+                        winner = static_cast<int>(i);
+                    }
+                    break;
+                }
+            }
+
+            bool any_active = attempts[0].active || attempts[1].active;
+            if (winner >= 0 || !any_active) {
+                break;
+            }
+
+            auto now = Clock::now();
+            if (owner) {
+                hedge_at = Clock::time_point::max();  // already streaming
+            }
+            if (launched == 1 && now >= hedge_at) {
+                // The duplicate only goes out if the weight budget has room for it
+                double weight = RateLimiter::requestWeight(url_path, request_type);
+                if (!rate_limiter_ || rate_limiter_->tryAcquire(weight)) {
+                    launch();
+                } else {
+                    hedge_at = Clock::time_point::max();
+                }
+            }
+
+            int wait_ms = 100;
+            if (launched == 1 && hedge_at != Clock::time_point::max()) {
+                auto until_hedge = std::chrono::duration_cast<std::chrono::milliseconds>(hedge_at - now);
+                wait_ms = static_cast<int>(std::max<int64_t>(0, std::min<int64_t>(wait_ms, until_hedge.count() + 1)));
+            }
+            curl_multi_wait(multi, nullptr, 0, wait_ms, nullptr);
+        }
+    }
+
+    // The slower request is abandoned; its connection is closed
+    for (size_t i = 0; i < launched; ++i) {
+        if (attempts[i].active) {
+            curl_multi_remove_handle(multi, attempts[i].curl);
+        }
+    }
+    curl_slist_free_all(headers);
+
+    if (launched == 2) {
+        transfer_stats_->recordHedge(url_path, request_type, winner == 1);
+    }
+
+    delivered = owner != nullptr;
+    Attempt& chosen = attempts[winner >= 0 ? winner : finished];
+    if (chosen.context.error) {
+        std::rethrow_exception(chosen.context.error);
+    }
+    if (chosen.result != CURLE_OK) {
+        throw NetworkError(std::string("HTTP request failed: ") + curl_easy_strerror(chosen.result),
+                           transientFailure(chosen.result));
+    }
+    last_transfer_ = std::move(chosen.timing);
+    response_body = std::move(on_data ? chosen.context.error_body : chosen.response);
+    return chosen.response_code;
+}
+
+void API::postManyStream(const std::string& url_path,
+                         const std::vector<nlohmann::json>& payloads,
+                         const IndexedChunkCallback& on_data,
+                         size_t max_in_flight) {
+    if (payloads.empty()) {
+        return;
+    }
+    CURLM* multi = static_cast<CURLM*>(multiHandle());
+
+    std::string url = base_url_ + url_path;
+    struct curl_slist* headers = nullptr;
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+
+    // Queries are idempotent; signed actions are never resent
+    bool idempotent = url_path == "/info";
+    bool hedging = idempotent && retry_policy_.hedge;
+
+    // One easy handle per concurrent slot, reused for later payloads
+    size_t slots = std::min(payloads.size(), max_in_flight == 0 ? size_t(1) : max_in_flight);
+    struct Transfer {
+        CURL* curl = nullptr;
+        size_t index = 0;
+        bool active = false;
+        bool hedge = false;  // duplicate of a slower request for the same payload
+        Clock::time_point started;
+        std::string body;
+        StreamContext context;
+    };
+    std::vector<Transfer> transfers(slots);
+
+    // Retry and hedge state per payload
+    struct Query {
+        int attempts = 0;
+        size_t in_flight = 0;
+        bool done = false;
+        bool hedged = false;  // the current attempt has a duplicate
+        void* owner = nullptr;
+        Clock::time_point deadline;
+        Clock::time_point started;
+        Clock::time_point hedge_at = Clock::time_point::max();
+    };
+    std::vector<Query> queries(payloads.size());
+    std::vector<std::pair<Clock::time_point, size_t>> retries;  // (ready at, payload index)
+
+    size_t next = 0;
+    std::exception_ptr first_error;
+    std::vector<Transfer*> idle;
+    size_t in_flight = 0;
+
+    // Waiting on the limiter would stop open transfers from being serviced,
+    // so only block when nothing is in flight; otherwise the slot stays idle
+    // and is retried from the loop below. Hedges never wait for weight.
+    auto start = [&](Transfer& transfer, size_t index, bool block, bool hedge) {
+        const std::string type = requestType(payloads[index]);
+        if (rate_limiter_) {
+            double weight = RateLimiter::requestWeight(url_path, type);
+            if (block && !hedge) {
+                rate_limiter_->acquire(weight, RateLimiter::laneFor(type));
+            } else if (!rate_limiter_->tryAcquire(weight, RateLimiter::laneFor(type))) {
+                return false;
+            }
+        }
+
+        Query& query = queries[index];
+        auto now = Clock::now();
+        if (!hedge) {
+            if (query.attempts++ == 0) {
+                query.deadline = retryDeadline(timeout_ms_);
+            }
+            query.started = now;
+            query.hedged = false;
+            query.hedge_at = hedging ? now + hedgeDelay(retry_policy_, *transfer_stats_, url_path, type)
+                                     : Clock::time_point::max();
+        } else {
+            query.hedged = true;
+        }
+        ++query.in_flight;
+
+        transfer.index = index;
+        transfer.active = true;
+        transfer.hedge = hedge;
+        transfer.started = now;
+        transfer.body = payloads[index].dump();
+        transfer.context = StreamContext();
+        transfer.context.curl = transfer.curl;
+        transfer.context.owner = hedging ? &query.owner : nullptr;
+        transfer.context.on_data = [&on_data, index](const char* data, size_t len) {
+            on_data(index, data, len);
+        };
+        int timeout_ms = idempotent ? attemptTimeout(retry_policy_, timeout_ms_, query.deadline) : timeout_ms_;
+        configureRequest(transfer.curl, url, transfer.body, headers, streamCallback, &transfer.context,
+                         timeout_ms);
+        curl_multi_add_handle(multi, transfer.curl);
+        return true;
+    };
+
+    auto release = [&](Transfer& transfer) {
+        curl_multi_remove_handle(multi, transfer.curl);
+        transfer.active = false;
+        --queries[transfer.index].in_flight;
+        idle.push_back(&transfer);
+        --in_flight;
+    };
+
+    auto finish = [&](Transfer& transfer, CURLcode result) {
+        release(transfer);
+        Query& query = queries[transfer.index];
+        const std::string type = requestType(payloads[transfer.index]);
+
+        // The loser of a hedged stream is aborted on purpose
+        if (query.owner && query.owner != transfer.curl) {
+            return;
+        }
+        if (result != CURLE_OK && result != CURLE_WRITE_ERROR) {
+            transfer_stats_->recordError(url_path, type);
+        } else {
+            auto offset = std::chrono::duration_cast<std::chrono::microseconds>(transfer.started - query.started);
+            recordTransfer(transfer.curl, url_path, type, nullptr, offset.count());
+        }
+        if (first_error) {
+            return;
+        }
+
+        std::exception_ptr error;
+        bool retryable = false;
+        try {
+            if (transfer.context.error) {
+                std::rethrow_exception(transfer.context.error);
+            }
+            if (result != CURLE_OK) {
+                throw NetworkError(std::string("HTTP request failed: ") + curl_easy_strerror(result),
+                                   transientFailure(result));
+            }
+            long response_code = 0;
+            curl_easy_getinfo(transfer.curl, CURLINFO_RESPONSE_CODE, &response_code);
+            updateRateLimit(transfer.curl, response_code);
+            retryable = response_code >= 500;
+            handleException(response_code, transfer.context.error_body);
+
+            query.done = true;
+            if (query.hedged) {
+                transfer_stats_->recordHedge(url_path, type, transfer.hedge);
+            }
+            // The slower request is abandoned; its connection is closed
+            for (auto& other : transfers) {
+                if (other.active && other.index == transfer.index) {
+                    release(other);
+                }
+            }
+            return;
+        } catch (const NetworkError& e) {
+            retryable = e.transient() && !transfer.context.delivered;
+            error = std::current_exception();
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        if (idempotent && retryable) {
+            // A duplicate still in flight may yet answer
+            if (query.in_flight > 0) {
+                return;
+            }
+            auto backoff = retryBackoff(retry_policy_, query.attempts);
+            if (query.attempts < retry_policy_.max_attempts && Clock::now() + backoff < query.deadline) {
+                transfer_stats_->recordRetry(url_path, type);
+                retries.emplace_back(Clock::now() + backoff, transfer.index);
+                return;
+            }
+        }
+        first_error = error;
+    };
+
+    for (auto& transfer : transfers) {
+        transfer.curl = curl_easy_init();
+        if (!transfer.curl) {
+            for (auto& created : transfers) {
+                if (created.curl) {
+                    curl_easy_cleanup(created.curl);
+                }
+            }
+            curl_slist_free_all(headers);
+            throw std::runtime_error("Failed to initialize libcurl");
+        }
+    }
+
+    for (auto& transfer : transfers) {
+        idle.push_back(&transfer);
+    }
+    while (true) {
+        // Stop issuing new requests once something has failed; retries due go first
+        auto now = Clock::now();
+        while (!idle.empty() && !first_error) {
+            auto retry = std::min_element(retries.begin(), retries.end());
+            bool retry_due = retry != retries.end() && retry->first <= now;
+            if (!retry_due && next == payloads.size()) {
+                break;
+            }
+            if (!start(*idle.back(), retry_due ? retry->second : next, in_flight == 0, false)) {
+                break;
+            }
+            if (retry_due) {
+                retries.erase(retry);
+            } else {
+                ++next;
+            }
+            idle.pop_back();
+            ++in_flight;
+        }
+
+        // Slots left idle at the tail of the batch duplicate slow queries
+        Clock::time_point wake = Clock::time_point::max();
+        if (hedging && !first_error && next == payloads.size()) {
+            for (auto& transfer : transfers) {
+                if (idle.empty()) {
+                    break;
+                }
+                Query& query = queries[transfer.index];
+                if (!transfer.active || query.hedged || query.owner) {
+                    continue;
+                }
+                if (query.hedge_at > now) {
+                    wake = std::min(wake, query.hedge_at);
+                } else if (start(*idle.back(), transfer.index, false, true)) {
+                    idle.pop_back();
+                    ++in_flight;
+                } else {
+                    query.hedge_at = Clock::time_point::max();
+                }
+            }
+        }
+        for (const auto& retry : retries) {
+            wake = std::min(wake, retry.first);
+        }
+
+        if (in_flight == 0) {
+            if (retries.empty() || first_error) {
+                break;
+            }
+            std::this_thread::sleep_until(wake);
+            continue;
+        }
+
+        int running = 0;
+        curl_multi_perform(multi, &running);
+
+        CURLMsg* message;
+        int queued;
+        while ((message = curl_multi_info_read(multi, &queued))) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+            for (auto& transfer : transfers) {
+                if (!transfer.active || transfer.curl != message->easy_handle) {
+                    continue;
+                }
+                finish(transfer, message->data.result);
+                break;
+            }
+        }
+
+        if (in_flight > 0) {
+            // Poll the limiter more often while a slot is waiting for weight
+            bool waiting_for_weight = !idle.empty() && next < payloads.size() && !first_error;
+            int64_t wait_ms = waiting_for_weight ? 10 : 100;
+            if (wake != Clock::time_point::max()) {
+                auto until_wake = std::chrono::duration_cast<std::chrono::milliseconds>(wake - Clock::now());
+                wait_ms = std::max<int64_t>(0, std::min<int64_t>(wait_ms, until_wake.count() + 1));
+            }
+            curl_multi_wait(multi, nullptr, 0, static_cast<int>(wait_ms), nullptr);
+        }
+    }
+
+    for (auto& transfer : transfers) {
+        curl_easy_cleanup(transfer.curl);
+    }
+    curl_slist_free_all(headers);
+
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
+std::vector<nlohmann::json> API::postMany(const std::string& url_path,
+                                          const std::vector<nlohmann::json>& payloads,
+                                          size_t max_in_flight) {
+    std::vector<std::string> bodies(payloads.size());
+    postManyStream(url_path, payloads, [&bodies](size_t index, const char* data, size_t len) {
+        bodies[index].append(data, len);
+    }, max_in_flight);
+
+    std::vector<nlohmann::json> results;
+    results.reserve(bodies.size());
+    for (const auto& body : bodies) {
+        try {
+            results.push_back(nlohmann::json::parse(body));
+        } catch (const nlohmann::json::parse_error& e) {
+            throw std::runtime_error(std::string("Failed to parse JSON response: ") + e.what());
+        }
     }
+    return results;
 }
 
 } // namespace hyperliquid
@@ -0,0 +1,250 @@
+#include "hyperliquid/candle_cache.hpp"
+#include "hyperliquid/info.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+
+namespace hyperliquid {
+
+namespace {
+
+constexpr char CANDLE_MAGIC[8] = {'H', 'L', 'C', 'N', 'D', 'L', '\0', '\0'};
+constexpr uint32_t CANDLE_VERSION = 1;
+
+struct CandleFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    int64_t covered_start;
+    int64_t covered_end;
+};
+
+struct CandleRecord {
+    int64_t time;
+    double open;
+    double high;
+    double low;
+    double close;
+    double volume;
+    int64_t trades;
+};
+
+static_assert(sizeof(CandleFileHeader) == 32, "Unexpected candle header size");
+static_assert(sizeof(CandleRecord) == 56, "Unexpected candle record size");
+
+// Merge rows from both inputs ordered by time; b wins on equal times
+Candles mergeByTime(const Candles& a, const Candles& b) {
+    std::vector<size_t> order_b(b.size());
+    std::iota(order_b.begin(), order_b.end(), 0);
+    std::stable_sort(order_b.begin(), order_b.end(), [&b](size_t x, size_t y) {
+        return b.time[x] < b.time[y];
+    });
+
+    Candles merged;
+    merged.reserve(a.size() + b.size());
+    size_t i = 0;
+    size_t j = 0;
+    while (i < a.size() || j < order_b.size()) {
+        bool take_b = i == a.size() ||
+            (j < order_b.size() && b.time[order_b[j]] <= a.time[i]);
+        if (take_b) {
+            if (i < a.size() && a.time[i] == b.time[order_b[j]]) {
+                ++i;
+            }
+            if (merged.empty() || merged.time.back() != b.time[order_b[j]]) {
+                merged.append(b, order_b[j]);
+            }
+            ++j;
+        } else {
+            merged.append(a, i);
+            ++i;
+        }
+    }
+    return merged;
+}
+
+} // namespace
+
+CandleCache::CandleCache(Info& info, const std::string& directory)
+    : info_(info), directory_(directory) {
+    std::filesystem::create_directories(directory_);
+}
+
+std::string CandleCache::pathFor(const std::string& coin, const std::string& interval) const {
+    // Coins may contain ':' (builder dexes) or '/' (spot pairs)
+    std::string file = coin + "_" + interval + ".candles";
+    for (char& c : file) {
+        if (c == '/' || c == ':' || c == '\\') {
+            c = '_';
+        }
+    }
+    return (std::filesystem::path(directory_) / file).string();
+}
+
+bool CandleCache::read(const std::string& path, Entry& entry) const {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    CandleFileHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, CANDLE_MAGIC, sizeof(CANDLE_MAGIC)) != 0 ||
+        header.version != CANDLE_VERSION) {
+        return false;  // unreadable cache is simply refetched
+    }
+    entry.covered_start = header.covered_start;
+    entry.covered_end = header.covered_end;
+
+    std::vector<CandleRecord> records;
+    CandleRecord record;
+    while (in.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        records.push_back(record);
+    }
+
+    entry.candles.clear();
+    entry.candles.reserve(records.size());
+    for (const auto& r : records) {
+        entry.candles.time.push_back(r.time);
+        entry.candles.open.push_back(r.open);
+        entry.candles.high.push_back(r.high);
+        entry.candles.low.push_back(r.low);
+        entry.candles.close.push_back(r.close);
+        entry.candles.volume.push_back(r.volume);
+        entry.candles.trades.push_back(r.trades);
+    }
+    return true;
+}
+
+void CandleCache::write(const std::string& path, const Entry& entry) const {
+    // Write beside the target and rename so readers never see a partial file
+    std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw std::runtime_error("Failed to open candle cache file: " + temp_path);
+        }
+
+        CandleFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, CANDLE_MAGIC, sizeof(CANDLE_MAGIC));
+        header.version = CANDLE_VERSION;
+        header.covered_start = entry.covered_start;
+        header.covered_end = entry.covered_end;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        const Candles& c = entry.candles;
+        for (size_t i = 0; i < c.size(); ++i) {
+            CandleRecord record{c.time[i], c.open[i], c.high[i], c.low[i],
+                                c.close[i], c.volume[i], c.trades[i]};
+            out.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        }
+        if (!out) {
+            throw std::runtime_error("Failed to write candle cache file: " + temp_path);
+        }
+    }
+    std::filesystem::rename(temp_path, path);
+}
+
+Candles CandleCache::load(const std::string& name,
+                          const std::string& interval,
+                          int64_t start_time,
+                          int64_t end_time) {
+    return std::move(loadMany({name}, interval, start_time, end_time).front());
+}
+
+std::vector<Candles> CandleCache::loadMany(const std::vector<std::string>& names,
+                                           const std::string& interval,
+                                           int64_t start_time,
+                                           int64_t end_time) {
+    if (end_time < start_time) {
+        throw std::invalid_argument("CandleCache end_time is before start_time");
+    }
+    int64_t interval_ms = candleIntervalMs(interval);
+    int64_t chunk_ms = interval_ms * MAX_CANDLES_PER_REQUEST;
+
+    std::vector<std::string> coins;
+    std::vector<std::string> paths;
+    std::vector<Entry> entries(names.size());
+    std::vector<CandleRequest> requests;
+    std::vector<size_t> owners;
+    std::vector<bool> extended(names.size(), false);
+
+    auto requestRange = [&](size_t owner, int64_t from, int64_t to) {
+        for (int64_t chunk_start = from; chunk_start <= to; chunk_start += chunk_ms) {
+            int64_t chunk_end = std::min(to, chunk_start + chunk_ms - 1);
+            requests.push_back({coins[owner], interval, chunk_start, chunk_end});
+            owners.push_back(owner);
+            extended[owner] = true;
+        }
+    };
+
+    for (size_t i = 0; i < names.size(); ++i) {
+        coins.push_back(info_.nameToCoin(names[i]));
+        paths.push_back(pathFor(coins[i], interval));
+
+        Entry& entry = entries[i];
+        if (!read(paths[i], entry) || entry.covered_end < entry.covered_start) {
+            entry = Entry();
+            requestRange(i, start_time, end_time);
+            continue;
+        }
+
+        // Extend coverage contiguously so the file never has holes
+        if (start_time < entry.covered_start) {
+            requestRange(i, start_time, entry.covered_start - 1);
+        }
+        if (end_time > entry.covered_end) {
+            requestRange(i, entry.covered_end + 1, end_time);
+        }
+    }
+
+    std::vector<Candles> fetched_parts = info_.candlesSnapshotMany(requests);
+    std::vector<Candles> fetched(names.size());
+    for (size_t r = 0; r < fetched_parts.size(); ++r) {
+        Candles& target = fetched[owners[r]];
+        for (size_t k = 0; k < fetched_parts[r].size(); ++k) {
+            target.append(fetched_parts[r], k);
+        }
+    }
+
+    // Only candles whose interval has ended are final
+    int64_t closed_end = getTimestampMs() - interval_ms;
+
+    std::vector<Candles> results(names.size());
+    for (size_t i = 0; i < names.size(); ++i) {
+        Entry& entry = entries[i];
+        Candles merged = mergeByTime(entry.candles, fetched[i]);
+
+        // A completed request covers its range even when it returned no
+        // candles (before listing, or no trades), so record that too
+        if (extended[i]) {
+            Entry updated;
+            bool had_coverage = entry.covered_end >= entry.covered_start;
+            updated.covered_start = had_coverage ? std::min(entry.covered_start, start_time) : start_time;
+            updated.covered_end = std::min(had_coverage ? std::max(entry.covered_end, end_time) : end_time,
+                                           closed_end);
+            for (size_t k = 0; k < merged.size(); ++k) {
+                if (merged.time[k] <= updated.covered_end) {
+                    updated.candles.append(merged, k);
+                }
+            }
+            if (updated.covered_end >= updated.covered_start) {
+                write(paths[i], updated);
+            }
+        }
+
+        for (size_t k = 0; k < merged.size(); ++k) {
+            if (merged.time[k] >= start_time && merged.time[k] <= end_time) {
+                results[i].append(merged, k);
+            }
+        }
+    }
+    return results;
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,187 @@
+#include "hyperliquid/candles.hpp"
+#include <cstdlib>
+#include <stdexcept>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+namespace {
+
+/**
+ * SAX handler reading one candle object ({"t","o","h","l","c","v","n",...})
+ */
+class CandleHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    explicit CandleHandler(Candles& out) : out_(out) {}
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+
+    bool number_integer(number_integer_t value) override {
+        setNumber(static_cast<int64_t>(value), static_cast<double>(value));
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setNumber(static_cast<int64_t>(value), static_cast<double>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        setNumber(static_cast<int64_t>(value), value);
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        if (depth_ == 1 && key_.size() == 1) {
+            double parsed = std::strtod(value.c_str(), nullptr);
+            setNumber(static_cast<int64_t>(parsed), parsed);
+        }
+        return true;
+    }
+
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        ++depth_;
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        if (depth_ == 1) {
+            key_ = value;
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        ++depth_;
+        return true;
+    }
+
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error_ = ex.what();
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    void setNumber(int64_t integer, double real) {
+        if (depth_ != 1 || key_.size() != 1) {
+            return;
+        }
+        switch (key_[0]) {
+            case 't': out_.time.back() = integer; break;
+            case 'o': out_.open.back() = real; break;
+            case 'h': out_.high.back() = real; break;
+            case 'l': out_.low.back() = real; break;
+            case 'c': out_.close.back() = real; break;
+            case 'v': out_.volume.back() = real; break;
+            case 'n': out_.trades.back() = integer; break;
+            default: break;
+        }
+    }
+
+    Candles& out_;
+    std::string key_;
+    int depth_ = 0;
+    std::string error_;
+};
+
+} // namespace
+
+void Candles::reserve(size_t n) {
+    time.reserve(n);
+    open.reserve(n);
+    high.reserve(n);
+    low.reserve(n);
+    close.reserve(n);
+    volume.reserve(n);
+    trades.reserve(n);
+}
+
+void Candles::clear() {
+    time.clear();
+    open.clear();
+    high.clear();
+    low.clear();
+    close.clear();
+    volume.clear();
+    trades.clear();
+}
+
+void Candles::append(const Candles& other, size_t i) {
+    time.push_back(other.time[i]);
+    open.push_back(other.open[i]);
+    high.push_back(other.high[i]);
+    low.push_back(other.low[i]);
+    close.push_back(other.close[i]);
+    volume.push_back(other.volume[i]);
+    trades.push_back(other.trades[i]);
+}
+
+int64_t candleIntervalMs(const std::string& interval) {
+    static const std::unordered_map<std::string, int64_t> intervals = {
+        {"1m", 60000LL},
+        {"3m", 3 * 60000LL},
+        {"5m", 5 * 60000LL},
+        {"15m", 15 * 60000LL},
+        {"30m", 30 * 60000LL},
+        {"1h", 3600000LL},
+        {"2h", 2 * 3600000LL},
+        {"4h", 4 * 3600000LL},
+        {"8h", 8 * 3600000LL},
+        {"12h", 12 * 3600000LL},
+        {"1d", 86400000LL},
+        {"3d", 3 * 86400000LL},
+        {"1w", 7 * 86400000LL},
+        {"1M", 31 * 86400000LL}
+    };
+    auto it = intervals.find(interval);
+    if (it == intervals.end()) {
+        throw std::invalid_argument("Unknown candle interval: " + interval);
+    }
+    return it->second;
+}
+
+CandleParser::CandleParser(Candles& out)
+    : out_(out),
+      stream_([this](std::string_view object) { emitCandle(object); }) {}
+
+void CandleParser::feed(const char* data, size_t len) {
+    stream_.feed(data, len);
+}
+
+void CandleParser::finish() {
+    stream_.finish();
+}
+
+void CandleParser::emitCandle(std::string_view object) {
+    // Open a zeroed row, then let the handler fill it in place
+    out_.time.push_back(0);
+    out_.open.push_back(0.0);
+    out_.high.push_back(0.0);
+    out_.low.push_back(0.0);
+    out_.close.push_back(0.0);
+    out_.volume.push_back(0.0);
+    out_.trades.push_back(0);
+
+    CandleHandler handler(out_);
+    if (!nlohmann::json::sax_parse(object.begin(), object.end(), &handler)) {
+        throw std::runtime_error("Failed to parse candle: " + handler.error());
+    }
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,319 @@
+#include "hyperliquid/clearinghouse.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <array>
+#include <stdexcept>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+namespace {
+
+enum class StateKey {
+    Other,
+    AssetPositions,
+    CrossMaintenanceMarginUsed,
+    CrossMarginSummary,
+    MarginSummary,
+    Time,
+    Withdrawable,
+    AccountValue,
+    TotalMarginUsed,
+    TotalNtlPos,
+    TotalRawUsd,
+    Position,
+    Coin,
+    CumFunding,
+    AllTime,
+    SinceOpen,
+    SinceChange,
+    EntryPx,
+    Leverage,
+    Type,
+    Value,
+    LiquidationPx,
+    MarginUsed,
+    MaxLeverage,
+    PositionValue,
+    ReturnOnEquity,
+    Szi,
+    UnrealizedPnl
+};
+
+StateKey keyFor(const std::string& key) {
+    static const std::unordered_map<std::string, StateKey> keys = {
+        {"assetPositions", StateKey::AssetPositions},
+        {"crossMaintenanceMarginUsed", StateKey::CrossMaintenanceMarginUsed},
+        {"crossMarginSummary", StateKey::CrossMarginSummary},
+        {"marginSummary", StateKey::MarginSummary},
+        {"time", StateKey::Time},
+        {"withdrawable", StateKey::Withdrawable},
+        {"accountValue", StateKey::AccountValue},
+        {"totalMarginUsed", StateKey::TotalMarginUsed},
+        {"totalNtlPos", StateKey::TotalNtlPos},
+        {"totalRawUsd", StateKey::TotalRawUsd},
+        {"position", StateKey::Position},
+        {"coin", StateKey::Coin},
+        {"cumFunding", StateKey::CumFunding},
+        {"allTime", StateKey::AllTime},
+        {"sinceOpen", StateKey::SinceOpen},
+        {"sinceChange", StateKey::SinceChange},
+        {"entryPx", StateKey::EntryPx},
+        {"leverage", StateKey::Leverage},
+        {"type", StateKey::Type},
+        {"value", StateKey::Value},
+        {"liquidationPx", StateKey::LiquidationPx},
+        {"marginUsed", StateKey::MarginUsed},
+        {"maxLeverage", StateKey::MaxLeverage},
+        {"positionValue", StateKey::PositionValue},
+        {"returnOnEquity", StateKey::ReturnOnEquity},
+        {"szi", StateKey::Szi},
+        {"unrealizedPnl", StateKey::UnrealizedPnl}
+    };
+    auto it = keys.find(key);
+    return it == keys.end() ? StateKey::Other : it->second;
+}
+
+// Nesting of the values we decode:
+//   1 {"marginSummary", "withdrawable", "assetPositions", ...}
+//   2   {"accountValue", ...} | [ ... ]
+//   3     {"position", "type"}
+//   4       {"coin", "szi", "entryPx", "cumFunding", "leverage", ...}
+//   5         {"allTime", ...} | {"type", "value"}
+constexpr int SUMMARY_DEPTH = 2;
+constexpr int POSITION_DEPTH = 4;
+constexpr int POSITION_DETAIL_DEPTH = 5;
+constexpr size_t MAX_TRACKED_DEPTH = 6;
+
+/**
+ * SAX handler filling a ClearinghouseState; anything outside the paths
+ * above is skipped
+ */
+class ClearinghouseHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    ClearinghouseHandler(const std::unordered_map<std::string, int>& coin_to_asset,
+                         ClearinghouseState& state)
+        : coin_to_asset_(coin_to_asset), state_(state) {}
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+
+    bool number_integer(number_integer_t value) override {
+        setInteger(value);
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setInteger(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = doubleToFixed(value);
+        }
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = decimalToFixed(value);
+        } else if (inPosition() && depth_ == POSITION_DEPTH && keyAt(POSITION_DEPTH) == StateKey::Coin) {
+            auto it = coin_to_asset_.find(value);
+            position_.asset = it == coin_to_asset_.end() ? -1 : it->second;
+        } else if (inPosition() && depth_ == POSITION_DETAIL_DEPTH &&
+                   keyAt(POSITION_DEPTH) == StateKey::Leverage &&
+                   keyAt(POSITION_DETAIL_DEPTH) == StateKey::Type) {
+            position_.is_cross = value == "cross";
+        }
+        return true;
+    }
+
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        ++depth_;
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = StateKey::Other;
+        }
+        if (depth_ == POSITION_DEPTH && inPosition()) {
+            position_ = AssetPosition();
+        }
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = keyFor(value);
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        if (depth_ == POSITION_DEPTH && inPosition()) {
+            commitPosition();
+        }
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        ++depth_;
+        if (static_cast<size_t>(depth_) < MAX_TRACKED_DEPTH) {
+            keys_[depth_] = StateKey::Other;
+        }
+        return true;
+    }
+
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error_ = ex.what();
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    StateKey keyAt(int depth) const { return keys_[depth]; }
+
+    bool inPosition() const {
+        return depth_ >= POSITION_DEPTH && keyAt(1) == StateKey::AssetPositions &&
+               keyAt(3) == StateKey::Position;
+    }
+
+    MarginSummary* summaryTarget() {
+        switch (keyAt(1)) {
+            case StateKey::MarginSummary: return &state_.margin_summary;
+            case StateKey::CrossMarginSummary: return &state_.cross_margin_summary;
+            default: return nullptr;
+        }
+    }
+
+    int64_t* fixedTarget() {
+        if (depth_ == 1) {
+            switch (keyAt(1)) {
+                case StateKey::CrossMaintenanceMarginUsed: return &state_.cross_maintenance_margin_used;
+                case StateKey::Withdrawable: return &state_.withdrawable;
+                default: return nullptr;
+            }
+        }
+        if (depth_ == SUMMARY_DEPTH) {
+            MarginSummary* summary = summaryTarget();
+            if (!summary) {
+                return nullptr;
+            }
+            switch (keyAt(SUMMARY_DEPTH)) {
+                case StateKey::AccountValue: return &summary->account_value;
+                case StateKey::TotalMarginUsed: return &summary->total_margin_used;
+                case StateKey::TotalNtlPos: return &summary->total_ntl_pos;
+                case StateKey::TotalRawUsd: return &summary->total_raw_usd;
+                default: return nullptr;
+            }
+        }
+        if (!inPosition()) {
+            return nullptr;
+        }
+        if (depth_ == POSITION_DEPTH) {
+            switch (keyAt(POSITION_DEPTH)) {
+                case StateKey::Szi: return &position_.szi;
+                case StateKey::EntryPx: return &position_.entry_px;
+                case StateKey::PositionValue: return &position_.position_value;
+                case StateKey::UnrealizedPnl: return &position_.unrealized_pnl;
+                case StateKey::ReturnOnEquity: return &position_.return_on_equity;
+                case StateKey::LiquidationPx: return &position_.liquidation_px;
+                case StateKey::MarginUsed: return &position_.margin_used;
+                default: return nullptr;
+            }
+        }
+        if (depth_ == POSITION_DETAIL_DEPTH && keyAt(POSITION_DEPTH) == StateKey::CumFunding) {
+            switch (keyAt(POSITION_DETAIL_DEPTH)) {
+                case StateKey::AllTime: return &position_.cum_funding_all_time;
+                case StateKey::SinceOpen: return &position_.cum_funding_since_open;
+                case StateKey::SinceChange: return &position_.cum_funding_since_change;
+                default: return nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    void setInteger(int64_t value) {
+        if (depth_ == 1 && keyAt(1) == StateKey::Time) {
+            state_.time = value;
+        } else if (inPosition() && depth_ == POSITION_DEPTH &&
+                   keyAt(POSITION_DEPTH) == StateKey::MaxLeverage) {
+            position_.max_leverage = static_cast<int>(value);
+        } else if (inPosition() && depth_ == POSITION_DETAIL_DEPTH &&
+                   keyAt(POSITION_DEPTH) == StateKey::Leverage &&
+                   keyAt(POSITION_DETAIL_DEPTH) == StateKey::Value) {
+            position_.leverage = static_cast<int>(value);
+        } else if (int64_t* target = fixedTarget()) {
+            *target = integerToFixed(value);
+        }
+    }
+
+    void commitPosition() {
+        if (position_.asset < 0) {
+            return;  // Coin not in the caller's metadata
+        }
+
+        int index = position_.asset % ClearinghouseState::PERP_DEX_STRIDE;
+        int offset = position_.asset - index;
+        if (state_.active.empty()) {
+            state_.asset_offset = offset;
+        } else if (offset != state_.asset_offset) {
+            return;  // A snapshot covers one dex; ignore anything else
+        }
+
+        if (static_cast<size_t>(index) >= state_.positions.size()) {
+            state_.positions.resize(static_cast<size_t>(index) + 1);
+        }
+        state_.positions[index] = position_;
+        state_.active.push_back(position_.asset);
+    }
+
+    const std::unordered_map<std::string, int>& coin_to_asset_;
+    ClearinghouseState& state_;
+    AssetPosition position_;
+    std::array<StateKey, MAX_TRACKED_DEPTH> keys_{};
+    int depth_ = 0;
+    std::string error_;
+};
+
+} // namespace
+
+const AssetPosition* ClearinghouseState::position(int asset) const {
+    int index = asset % PERP_DEX_STRIDE;
+    if (asset < 0 || asset - index != asset_offset ||
+        static_cast<size_t>(index) >= positions.size() || !positions[index].active()) {
+        return nullptr;
+    }
+    return &positions[index];
+}
+
+void ClearinghouseState::clear() {
+    for (int asset : active) {
+        positions[asset % PERP_DEX_STRIDE] = AssetPosition();
+    }
+    active.clear();
+    margin_summary = MarginSummary();
+    cross_margin_summary = MarginSummary();
+    cross_maintenance_margin_used = 0;
+    withdrawable = 0;
+    time = 0;
+    asset_offset = 0;
+}
+
+void parseClearinghouseState(std::string_view body,
+                             const std::unordered_map<std::string, int>& coin_to_asset,
+                             ClearinghouseState& state) {
+    state.clear();
+    ClearinghouseHandler handler(coin_to_asset, state);
+    if (!nlohmann::json::sax_parse(body.begin(), body.end(), &handler)) {
+        throw std::runtime_error("Failed to parse clearinghouseState: " + handler.error());
+    }
+}
+
+} // namespace hyperliquid
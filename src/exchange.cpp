@@ -1,6 +1,8 @@
 #include "hyperliquid/exchange.hpp"
 #include "hyperliquid/utils/constants.hpp"
 #include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/json_writer.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <cmath>
 
 namespace hyperliquid {
@@ -16,38 +18,59 @@ Exchange::Exchange(std::shared_ptr<Wallet> wallet,
     : API(base_url.empty() ? MAINNET_API_URL : base_url, timeout_ms),
       info_(base_url, true, meta, spot_meta, perp_dexs, timeout_ms),
       wallet_(wallet),
+      nonces_(NonceManager::forAddress(wallet->address())),
       vault_address_(vault_address),
       account_address_(account_address),
       expires_after_(std::nullopt) {
+    // One stats object and one weight budget for /info and /exchange
+    info_.setTransferStats(transferStats());
+    info_.setRateLimiter(rateLimiter());
 }
 
-nlohmann::json Exchange::postAction(const nlohmann::json& action,
-                                    const Signature& signature,
-                                    int64_t nonce) {
-    nlohmann::json payload = {
-        {"action", action},
-        {"nonce", nonce},
-        {"signature", signature.toJson()}
-    };
-
-    // Add vault address if not a transfer action
-    std::string action_type = action["type"];
-    if (action_type != "usdClassTransfer" && action_type != "sendAsset") {
-        if (!vault_address_.empty()) {
-            payload["vaultAddress"] = vault_address_;
-        } else {
-            payload["vaultAddress"] = nullptr;
+template <typename Action>
+void Exchange::postActionRaw(const Action& action,
+                             const Signature& signature,
+                             int64_t nonce,
+                             const std::string& vault_address,
+                             std::optional<int64_t> expires_after) {
+    // Vault address is sent for everything except transfer actions
+    const std::string& action_type = action["type"].template get_ref<const std::string&>();
+    bool include_vault = action_type != "usdClassTransfer" && action_type != "sendAsset";
+
+    writeExchangePayload(payload_buffer_, action, signature, nonce,
+                         include_vault, vault_address, expires_after);
+
+    // Batched actions weigh 1 + floor(batch / 40)
+    size_t batch_length = 0;
+    for (const char* key : {"orders", "cancels", "modifies"}) {
+        auto it = action.find(key);
+        if (it != action.end() && it->is_array()) {
+            batch_length = it->size();
+            break;
         }
     }
 
-    // Add expires after if set
-    if (expires_after_.has_value()) {
-        payload["expiresAfter"] = expires_after_.value();
-    } else {
-        payload["expiresAfter"] = nullptr;
-    }
+    postBodyRaw("/exchange", payload_buffer_, action_type, batch_length, response_buffer_);
+}
+
+template <typename Action>
+nlohmann::json Exchange::postAction(const Action& action,
+                                    const Signature& signature,
+                                    int64_t nonce,
+                                    const std::string& vault_address,
+                                    std::optional<int64_t> expires_after) {
+    postActionRaw(action, signature, nonce, vault_address, expires_after);
+    return parseBody(response_buffer_);
+}
 
-    return post("/exchange", payload);
+void Exchange::decodeResponse(ActionResponse& result, nlohmann::json* body) const {
+    if (body) {
+        *body = parseBody(response_buffer_);
+        actionResponseFromJson(*body, result);
+        return;
+    }
+    HYPERLIQUID_LATENCY_SCOPE(JsonParse);
+    parseActionResponse(response_buffer_, result);
 }
 
 double Exchange::slippagePrice(const std::string& name,
@@ -56,10 +79,9 @@ double Exchange::slippagePrice(const std::string& name,
                               std::optional<double> px) {
     std::string coin = info_.nameToCoin(name);
 
-    // Get mid price if not provided
+    // Get mid price if not provided (local book or cache, fetched only when stale)
     if (!px.has_value()) {
-        auto mids = info_.allMids("");
-        px = std::stod(mids[coin].get<std::string>());
+        px = info_.midPrice(coin);
     }
 
     int asset = info_.coin_to_asset_[coin];
@@ -74,10 +96,50 @@ double Exchange::slippagePrice(const std::string& name,
     return roundPrice(price, sz_decimals, is_spot);
 }
 
+void Exchange::syncPositions() {
+    positions_.seed(info_.userState(tradingAddress()), info_);
+}
+
+void Exchange::syncOpenOrders() {
+    order_manager_.seed(info_.openOrders(tradingAddress()), info_);
+}
+
+std::string Exchange::tradingAddress() const {
+    if (!vault_address_.empty()) {
+        return vault_address_;
+    }
+    if (!account_address_.empty()) {
+        return account_address_;
+    }
+    return wallet_->address();
+}
+
 void Exchange::setExpiresAfter(std::optional<int64_t> expires_after) {
     expires_after_ = expires_after;
 }
 
+void Exchange::setNonceManager(std::shared_ptr<NonceManager> nonces) {
+    if (!nonces) {
+        throw std::invalid_argument("NonceManager must not be null");
+    }
+    nonces_ = std::move(nonces);
+}
+
+void Exchange::setTransferStats(std::shared_ptr<TransferStats> stats) {
+    API::setTransferStats(stats);
+    info_.setTransferStats(std::move(stats));
+}
+
+void Exchange::setRateLimiter(std::shared_ptr<RateLimiter> limiter) {
+    API::setRateLimiter(limiter);
+    info_.setRateLimiter(std::move(limiter));
+}
+
+void Exchange::setRetryPolicy(const RetryPolicy& policy) {
+    API::setRetryPolicy(policy);
+    info_.setRetryPolicy(policy);
+}
+
 nlohmann::json Exchange::order(const std::string& coin,
                                bool is_buy,
                                double sz,
@@ -110,10 +172,34 @@ nlohmann::json Exchange::order(const std::string& coin,
 nlohmann::json Exchange::bulkOrders(const std::vector<OrderRequest>& orders,
                                     const std::optional<BuilderInfo>& builder,
                                     const std::string& grouping) {
+    return sendOrders(prepareOrders(orders, builder, grouping));
+}
+
+void Exchange::bulkOrders(const std::vector<OrderRequest>& orders,
+                          ActionResponse& result,
+                          const std::optional<BuilderInfo>& builder,
+                          const std::string& grouping) {
+    sendOrders(prepareOrders(orders, builder, grouping), result);
+}
+
+PreparedAction Exchange::prepareOrders(const std::vector<OrderRequest>& orders,
+                                       const std::optional<BuilderInfo>& builder,
+                                       const std::string& grouping) const {
+    return prepareOrders(orders, builder, grouping, vault_address_);
+}
+
+PreparedAction Exchange::prepareOrders(const std::vector<OrderRequest>& orders,
+                                       const std::optional<BuilderInfo>& builder,
+                                       const std::string& grouping,
+                                       const std::string& vault_address) const {
+    PreparedAction prepared;
+    prepared.vault_address = vault_address;
+    prepared.expires_after = expires_after_;
+
     std::vector<OrderWire> order_wires;
     for (const auto& order : orders) {
         int asset = info_.nameToAsset(order.coin);
-        int sz_decimals = info_.asset_to_sz_decimals_[asset];
+        int sz_decimals = info_.asset_to_sz_decimals_.at(asset);
         bool is_spot = asset >= 10000;
 
         // Round price and size to tick/lot size
@@ -122,23 +208,57 @@ nlohmann::json Exchange::bulkOrders(const std::vector<OrderRequest>& orders,
         rounded_order.sz = roundSize(order.sz, sz_decimals);
 
         order_wires.push_back(orderRequestToOrderWire(rounded_order, asset));
+        prepared.orders.push_back(std::move(rounded_order));
+        prepared.assets.push_back(asset);
     }
 
-    int64_t timestamp = getTimestampMs();
+    prepared.nonce = nonces_->next();
 
     // Create order action
-    auto action = orderWiresToOrderAction(order_wires, builder, grouping);
+    prepared.action = orderWiresToOrderAction(order_wires, builder, grouping);
 
     // Determine if mainnet
     bool is_mainnet = (base_url_ == MAINNET_API_URL);
 
     // Sign action
-    std::optional<std::string> vault_opt = vault_address_.empty() ?
-        std::nullopt : std::optional<std::string>(vault_address_);
-    auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
-                                 expires_after_, is_mainnet);
+    std::optional<std::string> vault_opt = vault_address.empty() ?
+        std::nullopt : std::optional<std::string>(vault_address);
+    prepared.signature = signL1Action(*wallet_, prepared.action, vault_opt, prepared.nonce,
+                                      prepared.expires_after, is_mainnet);
+
+    return prepared;
+}
+
+nlohmann::json Exchange::sendOrders(const PreparedAction& prepared) {
+    nlohmann::json body;
+    sendOrders(prepared, ack_, &body);
+    return body;
+}
+
+void Exchange::sendOrders(const PreparedAction& prepared, ActionResponse& result) {
+    sendOrders(prepared, result, nullptr);
+}
 
-    return postAction(action, signature, timestamp);
+void Exchange::sendOrders(const PreparedAction& prepared,
+                          ActionResponse& result,
+                          nlohmann::json* body) {
+    postActionRaw(prepared.action, prepared.signature, prepared.nonce,
+                  prepared.vault_address, prepared.expires_after);
+    decodeResponse(result, body);
+
+    order_manager_.onOrderResponse(prepared.orders, prepared.assets, result, info_);
+
+    // Keep the position tracker current from our own acks if requested; it
+    // only holds this exchange's account, not other vaults routed through it
+    if (positions_.tracksOrderAcks() && prepared.vault_address == vault_address_) {
+        std::vector<bool> sides;
+        std::vector<std::string> coins;
+        for (const auto& order : prepared.orders) {
+            sides.push_back(order.is_buy);
+            coins.push_back(info_.nameToCoin(order.coin));
+        }
+        positions_.applyOrderResponse(result, prepared.assets, sides, coins);
+    }
 }
 
 nlohmann::json Exchange::marketOpen(const std::string& coin,
@@ -162,19 +282,23 @@ nlohmann::json Exchange::marketClose(const std::string& coin,
                                      double slippage,
                                      const std::optional<Cloid>& cloid,
                                      const std::optional<BuilderInfo>& builder) {
-    // Get user state to determine position size and direction
-    std::string address = wallet_->address();
-    auto user_state = info_.userState(address);
-
-    // Find position
     double position_sz = 0.0;
     bool found = false;
-    for (const auto& asset_pos : user_state["assetPositions"]) {
-        auto pos = asset_pos["position"];
-        if (pos["coin"] == coin) {
-            position_sz = std::stod(pos["szi"].get<std::string>());
+
+    if (positions_.isFed()) {
+        // Use the local tracker to avoid a blocking userState request
+        auto position = positions_.position(info_.nameToAsset(coin));
+        if (position.has_value()) {
+            position_sz = position->szi;
+            found = true;
+        }
+    } else {
+        // Get user state to determine position size and direction
+        info_.userState(tradingAddress(), user_state_);
+        const AssetPosition* position = user_state_.position(info_.nameToAsset(coin));
+        if (position) {
+            position_sz = fixedToDouble(position->szi);
             found = true;
-            break;
         }
     }
 
@@ -202,53 +326,101 @@ nlohmann::json Exchange::cancelByCloid(const std::string& coin, const Cloid& clo
 }
 
 nlohmann::json Exchange::bulkCancel(const std::vector<CancelRequest>& cancels) {
+    nlohmann::json body;
+    bulkCancel(cancels, ack_, &body, vault_address_);
+    return body;
+}
+
+void Exchange::bulkCancel(const std::vector<CancelRequest>& cancels,
+                          ActionResponse& result) {
+    bulkCancel(cancels, result, nullptr, vault_address_);
+}
+
+void Exchange::bulkCancel(const std::vector<CancelRequest>& cancels,
+                          ActionResponse& result,
+                          nlohmann::json* body,
+                          const std::string& vault_address) {
     nlohmann::ordered_json cancels_array = nlohmann::ordered_json::array();
+    std::vector<OidOrCloid> targets;
     for (const auto& cancel : cancels) {
         int asset = info_.nameToAsset(cancel.coin);
         nlohmann::ordered_json cancel_obj;
         cancel_obj["a"] = asset;
         cancel_obj["o"] = cancel.oid;
         cancels_array.push_back(cancel_obj);
+        targets.push_back(cancel.oid);
     }
 
     nlohmann::ordered_json action;
     action["type"] = "cancel";
     action["cancels"] = cancels_array;
 
-    int64_t timestamp = getTimestampMs();
+    int64_t timestamp = nonces_->next();
     bool is_mainnet = (base_url_ == MAINNET_API_URL);
 
-    std::optional<std::string> vault_opt = vault_address_.empty() ?
-        std::nullopt : std::optional<std::string>(vault_address_);
+    std::optional<int64_t> expires_after = expires_after_;
+    std::optional<std::string> vault_opt = vault_address.empty() ?
+        std::nullopt : std::optional<std::string>(vault_address);
     auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
-                                 expires_after_, is_mainnet);
+                                 expires_after, is_mainnet);
 
-    return postAction(action, signature, timestamp);
+    postActionRaw(action, signature, timestamp, vault_address, expires_after);
+    if (body && order_manager_.openCount() == 0) {
+        // Nothing tracked to reconcile; the caller only wants the document
+        *body = parseBody(response_buffer_);
+        return;
+    }
+    decodeResponse(result, body);
+    order_manager_.onCancelResponse(targets, result);
 }
 
 nlohmann::json Exchange::bulkCancelByCloid(const std::vector<CancelByCloidRequest>& cancels) {
+    nlohmann::json body;
+    bulkCancelByCloid(cancels, ack_, &body, vault_address_);
+    return body;
+}
+
+void Exchange::bulkCancelByCloid(const std::vector<CancelByCloidRequest>& cancels,
+                                 ActionResponse& result) {
+    bulkCancelByCloid(cancels, result, nullptr, vault_address_);
+}
+
+void Exchange::bulkCancelByCloid(const std::vector<CancelByCloidRequest>& cancels,
+                                 ActionResponse& result,
+                                 nlohmann::json* body,
+                                 const std::string& vault_address) {
     nlohmann::ordered_json cancels_array = nlohmann::ordered_json::array();
+    std::vector<OidOrCloid> targets;
     for (const auto& cancel : cancels) {
         int asset = info_.nameToAsset(cancel.coin);
         nlohmann::ordered_json cancel_obj;
         cancel_obj["a"] = asset;
         cancel_obj["o"] = cancel.cloid.toRaw();
         cancels_array.push_back(cancel_obj);
+        targets.push_back(cancel.cloid);
     }
 
     nlohmann::ordered_json action;
     action["type"] = "cancel";
     action["cancels"] = cancels_array;
 
-    int64_t timestamp = getTimestampMs();
+    int64_t timestamp = nonces_->next();
     bool is_mainnet = (base_url_ == MAINNET_API_URL);
 
-    std::optional<std::string> vault_opt = vault_address_.empty() ?
-        std::nullopt : std::optional<std::string>(vault_address_);
+    std::optional<int64_t> expires_after = expires_after_;
+    std::optional<std::string> vault_opt = vault_address.empty() ?
+        std::nullopt : std::optional<std::string>(vault_address);
     auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
-                                 expires_after_, is_mainnet);
+                                 expires_after, is_mainnet);
 
-    return postAction(action, signature, timestamp);
+    postActionRaw(action, signature, timestamp, vault_address, expires_after);
+    if (body && order_manager_.openCount() == 0) {
+        // Nothing tracked to reconcile; the caller only wants the document
+        *body = parseBody(response_buffer_);
+        return;
+    }
+    decodeResponse(result, body);
+    order_manager_.onCancelResponse(targets, result);
 }
 
 nlohmann::json Exchange::modifyOrder(const OidOrCloid& oid,
@@ -282,9 +454,25 @@ nlohmann::json Exchange::modifyOrder(const OidOrCloid& oid,
 }
 
 nlohmann::json Exchange::bulkModifyOrders(const std::vector<ModifyRequest>& modifies) {
+    nlohmann::json body;
+    bulkModifyOrders(modifies, ack_, &body, vault_address_);
+    return body;
+}
+
+void Exchange::bulkModifyOrders(const std::vector<ModifyRequest>& modifies,
+                                ActionResponse& result) {
+    bulkModifyOrders(modifies, result, nullptr, vault_address_);
+}
+
+void Exchange::bulkModifyOrders(const std::vector<ModifyRequest>& modifies,
+                                ActionResponse& result,
+                                nlohmann::json* body,
+                                const std::string& vault_address) {
     nlohmann::ordered_json modifies_array = nlohmann::ordered_json::array();
+    std::vector<int> assets;
     for (const auto& modify : modifies) {
         int asset = info_.nameToAsset(modify.order.coin);
+        assets.push_back(asset);
         int sz_decimals = info_.asset_to_sz_decimals_[asset];
         bool is_spot = asset >= 10000;
 
@@ -310,15 +498,60 @@ nlohmann::json Exchange::bulkModifyOrders(const std::vector<ModifyRequest>& modi
     action["type"] = "batchModify";
     action["modifies"] = modifies_array;
 
-    int64_t timestamp = getTimestampMs();
+    int64_t timestamp = nonces_->next();
+    bool is_mainnet = (base_url_ == MAINNET_API_URL);
+
+    std::optional<int64_t> expires_after = expires_after_;
+    std::optional<std::string> vault_opt = vault_address.empty() ?
+        std::nullopt : std::optional<std::string>(vault_address);
+    auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
+                                 expires_after, is_mainnet);
+
+    postActionRaw(action, signature, timestamp, vault_address, expires_after);
+    decodeResponse(result, body);
+    order_manager_.onModifyResponse(modifies, assets, result, info_);
+}
+
+QuoteSlot Exchange::makeQuoteSlot(const std::string& coin,
+                                  bool is_buy,
+                                  const std::string& tif,
+                                  const std::optional<Cloid>& cloid,
+                                  bool reduce_only) {
+    int asset = info_.nameToAsset(coin);
+    int sz_decimals = info_.asset_to_sz_decimals_[asset];
+    Cloid slot_cloid = cloid.has_value() ? cloid.value() : CloidGenerator::global().next();
+
+    return QuoteSlot(asset, coin, is_buy, tif, slot_cloid, sz_decimals, reduce_only);
+}
+
+nlohmann::json Exchange::placeQuote(QuoteSlot& slot, double px, double sz) {
+    slot.update(px, sz);
+
+    OrderType order_type;
+    order_type.limit = LimitOrderType{slot.tif()};
+
+    return order(slot.coin(), slot.isBuy(), slot.sz(), slot.px(), order_type,
+                 slot.reduceOnly(), slot.cloid());
+}
+
+nlohmann::json Exchange::updateQuote(QuoteSlot& slot, double px, double sz) {
+    slot.update(px, sz);
+
+    int64_t timestamp = nonces_->next();
     bool is_mainnet = (base_url_ == MAINNET_API_URL);
 
+    std::optional<int64_t> expires_after = expires_after_;
     std::optional<std::string> vault_opt = vault_address_.empty() ?
         std::nullopt : std::optional<std::string>(vault_address_);
-    auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
-                                 expires_after_, is_mainnet);
+    auto signature = signL1ActionPacked(*wallet_, slot.packedAction(), vault_opt, timestamp,
+                                        expires_after, is_mainnet);
+
+    postActionRaw(slot.action(), signature, timestamp, vault_address_, expires_after);
+    nlohmann::json body;
+    decodeResponse(ack_, &body);
+    order_manager_.onModifyResponse({slot.modifyRequest()}, {slot.asset()}, ack_, info_);
 
-    return postAction(action, signature, timestamp);
+    return body;
 }
 
 nlohmann::json Exchange::usdTransfer(double amount, const std::string& destination) {
@@ -326,7 +559,7 @@ nlohmann::json Exchange::usdTransfer(double amount, const std::string& destinati
         {"type", "usdSend"},
         {"destination", destination},
         {"amount", floatToWire(amount)},
-        {"time", getTimestampMs()}
+        {"time", nonces_->next()}
     };
 
     std::vector<EIP712Type> payload_types = {
@@ -341,7 +574,7 @@ nlohmann::json Exchange::usdTransfer(double amount, const std::string& destinati
                                          "HyperliquidTransaction:UsdSend",
                                          is_mainnet);
 
-    return postAction(action, signature, action["time"]);
+    return postAction(action, signature, action["time"], vault_address_, expires_after_);
 }
 
 nlohmann::json Exchange::spotTransfer(double amount,
@@ -352,7 +585,7 @@ nlohmann::json Exchange::spotTransfer(double amount,
         {"destination", destination},
         {"token", token},
         {"amount", floatToWire(amount)},
-        {"time", getTimestampMs()}
+        {"time", nonces_->next()}
     };
 
     std::vector<EIP712Type> payload_types = {
@@ -368,12 +601,19 @@ nlohmann::json Exchange::spotTransfer(double amount,
                                          "HyperliquidTransaction:SpotSend",
                                          is_mainnet);
 
-    return postAction(action, signature, action["time"]);
+    return postAction(action, signature, action["time"], vault_address_, expires_after_);
 }
 
 nlohmann::json Exchange::updateLeverage(int leverage,
                                         const std::string& coin,
                                         bool is_cross) {
+    return updateLeverage(leverage, coin, is_cross, vault_address_);
+}
+
+nlohmann::json Exchange::updateLeverage(int leverage,
+                                        const std::string& coin,
+                                        bool is_cross,
+                                        const std::string& vault_address) {
     int asset = info_.nameToAsset(coin);
 
     nlohmann::ordered_json leverage_obj;
@@ -391,19 +631,20 @@ nlohmann::json Exchange::updateLeverage(int leverage,
     action["isCross"] = is_cross;
     action["leverage"] = leverage;
 
-    int64_t timestamp = getTimestampMs();
+    int64_t timestamp = nonces_->next();
     bool is_mainnet = (base_url_ == MAINNET_API_URL);
 
-    std::optional<std::string> vault_opt = vault_address_.empty() ?
-        std::nullopt : std::optional<std::string>(vault_address_);
+    std::optional<int64_t> expires_after = expires_after_;
+    std::optional<std::string> vault_opt = vault_address.empty() ?
+        std::nullopt : std::optional<std::string>(vault_address);
     auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
-                                 expires_after_, is_mainnet);
+                                 expires_after, is_mainnet);
 
-    return postAction(action, signature, timestamp);
+    return postAction(action, signature, timestamp, vault_address, expires_after);
 }
 
 nlohmann::json Exchange::scheduleCancel(std::optional<int64_t> time) {
-    int64_t timestamp = getTimestampMs();
+    int64_t timestamp = nonces_->next();
 
     nlohmann::ordered_json action;
     action["type"] = "scheduleCancel";
@@ -413,12 +654,13 @@ nlohmann::json Exchange::scheduleCancel(std::optional<int64_t> time) {
 
     bool is_mainnet = (base_url_ == MAINNET_API_URL);
 
+    std::optional<int64_t> expires_after = expires_after_;
     std::optional<std::string> vault_opt = vault_address_.empty() ?
         std::nullopt : std::optional<std::string>(vault_address_);
     auto signature = signL1Action(*wallet_, action, vault_opt, timestamp,
-                                 expires_after_, is_mainnet);
+                                 expires_after, is_mainnet);
 
-    return postAction(action, signature, timestamp);
+    return postAction(action, signature, timestamp, vault_address_, expires_after);
 }
 
 nlohmann::json Exchange::queryOrderByCloid(const std::string& user, const Cloid& cloid) {
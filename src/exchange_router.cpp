@@ -0,0 +1,57 @@
+#include "hyperliquid/exchange_router.hpp"
+
+namespace hyperliquid {
+
+ExchangeRouter::ExchangeRouter(Exchange& exchange) : exchange_(exchange) {}
+
+void ExchangeRouter::bulkOrders(const std::string& vault_address,
+                                const std::vector<OrderRequest>& orders,
+                                ActionResponse& result,
+                                const std::optional<BuilderInfo>& builder,
+                                const std::string& grouping) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exchange_.sendOrders(exchange_.prepareOrders(orders, builder, grouping, vault_address),
+                         result, nullptr);
+}
+
+void ExchangeRouter::bulkCancel(const std::string& vault_address,
+                                const std::vector<CancelRequest>& cancels,
+                                ActionResponse& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exchange_.bulkCancel(cancels, result, nullptr, vault_address);
+}
+
+void ExchangeRouter::bulkCancelByCloid(const std::string& vault_address,
+                                       const std::vector<CancelByCloidRequest>& cancels,
+                                       ActionResponse& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exchange_.bulkCancelByCloid(cancels, result, nullptr, vault_address);
+}
+
+void ExchangeRouter::bulkModifyOrders(const std::string& vault_address,
+                                      const std::vector<ModifyRequest>& modifies,
+                                      ActionResponse& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    exchange_.bulkModifyOrders(modifies, result, nullptr, vault_address);
+}
+
+nlohmann::json ExchangeRouter::updateLeverage(const std::string& vault_address,
+                                              int leverage,
+                                              const std::string& coin,
+                                              bool is_cross) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return exchange_.updateLeverage(leverage, coin, is_cross, vault_address);
+}
+
+void ExchangeRouter::snapshots(const std::vector<std::string>& addresses,
+                               std::vector<AccountSnapshot>& snapshots,
+                               size_t max_in_flight) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.resize(addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        requests_[i].user = addresses[i];
+    }
+    exchange_.info_.accountSnapshots(requests_, snapshots, max_in_flight);
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,132 @@
+#include "hyperliquid/fill_history.hpp"
+#include "hyperliquid/info.hpp"
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+
+namespace {
+
+struct Window {
+    int64_t end = 0;
+    bool done = false;
+    std::vector<Fill> fills;
+};
+
+} // namespace
+
+FillHistory::FillHistory(Info& info, FillHistoryOptions options)
+    : info_(info), options_(options) {
+    if (options_.window_ms <= 0 || options_.page_limit == 0) {
+        throw std::invalid_argument("Invalid FillHistory options");
+    }
+    if (options_.max_in_flight == 0) {
+        options_.max_in_flight = 1;
+    }
+}
+
+size_t FillHistory::fetch(const std::string& address,
+                          int64_t start_time,
+                          int64_t end_time,
+                          SymbolTable& symbols,
+                          const FillCallback& on_fill) {
+    if (end_time < start_time) {
+        throw std::invalid_argument("FillHistory end_time is before start_time");
+    }
+
+    // Windows keyed by start time; pending holds those not yet requested
+    std::map<int64_t, Window> windows;
+    std::deque<int64_t> pending;
+    for (int64_t start = start_time; start <= end_time;) {
+        int64_t end = std::min(end_time, start + options_.window_ms - 1);
+        windows[start].end = end;
+        pending.push_back(start);
+        if (end == end_time) {
+            break;
+        }
+        start = end + 1;
+    }
+
+    truncated_ = false;
+    int64_t cursor = start_time;  // start of the next window to emit
+    std::set<FillKey> previous_keys;
+    size_t delivered = 0;
+
+    auto emitReady = [&]() {
+        auto it = windows.find(cursor);
+        while (it != windows.end() && it->second.done) {
+            auto& fills = it->second.fills;
+            std::sort(fills.begin(), fills.end(), [](const Fill& a, const Fill& b) {
+                return a.time != b.time ? a.time < b.time : a.tid < b.tid;
+            });
+
+            // Only adjacent windows can overlap, so remember one window of keys
+            std::set<FillKey> keys;
+            for (const auto& fill : fills) {
+                FillKey key = fillKey(fill);
+                if (previous_keys.count(key) || !keys.insert(key).second) {
+                    continue;
+                }
+                on_fill(fill);
+                ++delivered;
+            }
+            previous_keys = std::move(keys);
+
+            if (it->second.end == end_time) {
+                cursor = end_time;
+                windows.erase(it);
+                return;
+            }
+            cursor = it->second.end + 1;
+            windows.erase(it);
+            it = windows.find(cursor);
+        }
+    };
+
+    while (!pending.empty()) {
+        std::vector<std::pair<int64_t, int64_t>> batch;
+        while (!pending.empty() && batch.size() < options_.max_in_flight) {
+            int64_t start = pending.front();
+            pending.pop_front();
+            batch.emplace_back(start, windows[start].end);
+        }
+
+        std::vector<std::vector<Fill>> results(batch.size());
+        info_.userFillsByTimeWindows(address, batch, symbols,
+            [&results](size_t index, const Fill& fill) {
+                results[index].push_back(fill);
+            }, options_.max_in_flight);
+
+        // Split truncated windows (in reverse so earlier halves run first)
+        for (size_t i = batch.size(); i-- > 0;) {
+            int64_t start = batch[i].first;
+            int64_t end = batch[i].second;
+            bool full = results[i].size() >= options_.page_limit;
+            if (full && end == start) {
+                truncated_ = true;  // Cannot split a single millisecond
+            } else if (full) {
+                int64_t middle = start + (end - start) / 2;
+                windows.erase(start);
+                windows[start].end = middle;
+                windows[middle + 1].end = end;
+                pending.push_front(middle + 1);
+                pending.push_front(start);
+                continue;
+            }
+            Window& window = windows[start];
+            window.fills = std::move(results[i]);
+            window.done = true;
+        }
+
+        emitReady();
+    }
+
+    return delivered;
+}
+
+} // namespace hyperliquid
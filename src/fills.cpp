@@ -0,0 +1,241 @@
+#include "hyperliquid/fills.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+namespace {
+
+enum class FillField {
+    Other,
+    Coin,
+    Px,
+    Sz,
+    Side,
+    Time,
+    StartPosition,
+    Dir,
+    ClosedPnl,
+    Hash,
+    Oid,
+    Crossed,
+    Fee,
+    Tid,
+    FeeToken,
+    Cloid
+};
+
+FillField fieldForKey(const std::string& key) {
+    static const std::unordered_map<std::string, FillField> fields = {
+        {"coin", FillField::Coin},
+        {"px", FillField::Px},
+        {"sz", FillField::Sz},
+        {"side", FillField::Side},
+        {"time", FillField::Time},
+        {"startPosition", FillField::StartPosition},
+        {"dir", FillField::Dir},
+        {"closedPnl", FillField::ClosedPnl},
+        {"hash", FillField::Hash},
+        {"oid", FillField::Oid},
+        {"crossed", FillField::Crossed},
+        {"fee", FillField::Fee},
+        {"tid", FillField::Tid},
+        {"feeToken", FillField::FeeToken},
+        {"cloid", FillField::Cloid}
+    };
+    auto it = fields.find(key);
+    return it == fields.end() ? FillField::Other : it->second;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+void parseHash(const std::string& value, std::array<uint8_t, 32>& out) {
+    out.fill(0);
+    if (value.size() != 66 || value[0] != '0' || (value[1] != 'x' && value[1] != 'X')) {
+        return;
+    }
+    for (size_t i = 0; i < out.size(); ++i) {
+        int high = hexValue(value[2 + i * 2]);
+        int low = hexValue(value[3 + i * 2]);
+        if (high < 0 || low < 0) {
+            out.fill(0);
+            return;
+        }
+        out[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+}
+
+/**
+ * SAX handler filling a Fill from one fill object; nested values
+ * (e.g. "liquidation") are skipped
+ */
+class FillHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    FillHandler(SymbolTable& symbols, Fill& fill) : symbols_(symbols), fill_(fill) {}
+
+    bool null() override { return true; }
+
+    bool boolean(bool value) override {
+        if (depth_ == 1 && field_ == FillField::Crossed) {
+            fill_.crossed = value;
+        }
+        return true;
+    }
+
+    bool number_integer(number_integer_t value) override {
+        setInteger(value);
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setInteger(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        if (int64_t* target = fixedTarget()) {
+            *target = doubleToFixed(value);
+        }
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        if (depth_ != 1) {
+            return true;
+        }
+        if (int64_t* target = fixedTarget()) {
+            *target = decimalToFixed(value);
+            return true;
+        }
+        switch (field_) {
+            case FillField::Coin:
+                fill_.coin = symbols_.intern(value);
+                break;
+            case FillField::Side:
+                fill_.side = (value == "B") ? Side::Buy : Side::Sell;
+                break;
+            case FillField::Dir:
+                fill_.dir = symbols_.intern(value);
+                break;
+            case FillField::FeeToken:
+                fill_.fee_token = symbols_.intern(value);
+                break;
+            case FillField::Hash:
+                parseHash(value, fill_.hash);
+                break;
+            case FillField::Cloid:
+                fill_.cloid = Cloid(value);
+                break;
+            default:
+                break;
+        }
+        return true;
+    }
+
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        ++depth_;
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        if (depth_ == 1) {
+            field_ = fieldForKey(value);
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        ++depth_;
+        return true;
+    }
+
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error_ = ex.what();
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    int64_t* fixedTarget() {
+        if (depth_ != 1) {
+            return nullptr;
+        }
+        switch (field_) {
+            case FillField::Px: return &fill_.px;
+            case FillField::Sz: return &fill_.sz;
+            case FillField::Fee: return &fill_.fee;
+            case FillField::ClosedPnl: return &fill_.closed_pnl;
+            case FillField::StartPosition: return &fill_.start_position;
+            default: return nullptr;
+        }
+    }
+
+    void setInteger(int64_t value) {
+        if (depth_ != 1) {
+            return;
+        }
+        switch (field_) {
+            case FillField::Time: fill_.time = value; break;
+            case FillField::Oid: fill_.oid = value; break;
+            case FillField::Tid: fill_.tid = value; break;
+            default:
+                if (int64_t* target = fixedTarget()) {
+                    *target = integerToFixed(value);
+                }
+                break;
+        }
+    }
+
+    SymbolTable& symbols_;
+    Fill& fill_;
+    FillField field_ = FillField::Other;
+    int depth_ = 0;
+    std::string error_;
+};
+
+} // namespace
+
+FillParser::FillParser(SymbolTable& symbols, FillCallback on_fill)
+    : symbols_(symbols),
+      on_fill_(std::move(on_fill)),
+      stream_([this](std::string_view object) { emitFill(object); }) {}
+
+void FillParser::feed(const char* data, size_t len) {
+    stream_.feed(data, len);
+}
+
+void FillParser::finish() {
+    stream_.finish();
+}
+
+void FillParser::emitFill(std::string_view object) {
+    Fill fill;
+    FillHandler handler(symbols_, fill);
+    if (!nlohmann::json::sax_parse(object.begin(), object.end(), &handler)) {
+        throw std::runtime_error("Failed to parse fill: " + handler.error());
+    }
+    on_fill_(fill);
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,364 @@
+#include "hyperliquid/funding.hpp"
+#include "hyperliquid/info.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <stdexcept>
+#include <unordered_set>
+#include <nlohmann/json.hpp>
+
+namespace hyperliquid {
+
+namespace {
+
+constexpr double HOURS_PER_YEAR = 24.0 * 365.0;
+
+/**
+ * SAX handler for one fundingHistory entry ({"coin","fundingRate",
+ * "premium","time"}) or userFunding entry ({"delta":{"coin",
+ * "fundingRate","szi","usdc",...},"hash","time"})
+ */
+class FundingHandler : public nlohmann::json_sax<nlohmann::json> {
+public:
+    FundingHandler(FundingSeries* series, UserFunding* user, SymbolTable* symbols)
+        : series_(series), user_(user), symbols_(symbols) {}
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+
+    bool number_integer(number_integer_t value) override {
+        setTime(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_unsigned(number_unsigned_t value) override {
+        setTime(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool number_float(number_float_t value, const string_t&) override {
+        setTime(static_cast<int64_t>(value));
+        return true;
+    }
+
+    bool string(string_t& value) override {
+        const std::string* field = valueKey();
+        if (!field) {
+            return true;
+        }
+        if (*field == "coin") {
+            if (user_) {
+                user_->coin.back() = symbols_->intern(value);
+            }
+            return true;
+        }
+
+        double parsed = std::strtod(value.c_str(), nullptr);
+        if (*field == "fundingRate") {
+            (series_ ? series_->rate : user_->rate).back() = parsed;
+        } else if (*field == "premium" && series_) {
+            series_->premium.back() = parsed;
+        } else if (*field == "szi" && user_) {
+            user_->szi.back() = parsed;
+        } else if (*field == "usdc" && user_) {
+            user_->usdc.back() = parsed;
+        }
+        return true;
+    }
+
+    bool binary(binary_t&) override { return true; }
+
+    bool start_object(std::size_t) override {
+        ++depth_;
+        if (depth_ == 2) {
+            parent_ = key_;
+        }
+        return true;
+    }
+
+    bool key(string_t& value) override {
+        if (depth_ == 1) {
+            key_ = value;
+        } else if (depth_ == 2) {
+            inner_key_ = value;
+        }
+        return true;
+    }
+
+    bool end_object() override {
+        --depth_;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        ++depth_;
+        parent_.clear();
+        return true;
+    }
+
+    bool end_array() override {
+        --depth_;
+        return true;
+    }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) override {
+        error_ = ex.what();
+        return false;
+    }
+
+    const std::string& error() const { return error_; }
+
+private:
+    // Key naming the current scalar: top-level for rates, inside "delta" for payments
+    const std::string* valueKey() const {
+        if (series_ && depth_ == 1) {
+            return &key_;
+        }
+        if (user_ && depth_ == 2 && parent_ == "delta") {
+            return &inner_key_;
+        }
+        return nullptr;
+    }
+
+    void setTime(int64_t value) {
+        if (depth_ == 1 && key_ == "time") {
+            (series_ ? series_->time : user_->time).back() = value;
+        }
+    }
+
+    FundingSeries* series_;
+    UserFunding* user_;
+    SymbolTable* symbols_;
+    std::string key_;
+    std::string inner_key_;
+    std::string parent_;
+    int depth_ = 0;
+    std::string error_;
+};
+
+// Index range [first, last) of entries with start_time <= time <= end_time
+std::pair<size_t, size_t> timeRange(const std::vector<int64_t>& time, int64_t start_time, int64_t end_time) {
+    auto first = std::lower_bound(time.begin(), time.end(), start_time);
+    auto last = std::upper_bound(first, time.end(), end_time);
+    return {static_cast<size_t>(first - time.begin()), static_cast<size_t>(last - time.begin())};
+}
+
+double sumRange(const std::vector<double>& values, size_t first, size_t last) {
+    double sum = 0.0;
+    for (size_t i = first; i < last; ++i) {
+        sum += values[i];
+    }
+    return sum;
+}
+
+// Start of the page after a full one: its last timestamp again, since more
+// entries may share it. A page that is a single timestamp from the request
+// start cannot be split further, so move past it rather than loop forever.
+int64_t nextPageStart(const std::vector<int64_t>& page_time, int64_t request_start) {
+    int64_t last = page_time.back();
+    if (page_time.front() == last && last == request_start) {
+        return last + 1;
+    }
+    return last;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// FundingParser
+// ---------------------------------------------------------------------------
+
+FundingParser::FundingParser(FundingSeries& out)
+    : series_(&out),
+      stream_([this](std::string_view object) { emit(object); }) {}
+
+FundingParser::FundingParser(UserFunding& out, SymbolTable& symbols)
+    : user_(&out),
+      symbols_(&symbols),
+      stream_([this](std::string_view object) { emit(object); }) {}
+
+void FundingParser::feed(const char* data, size_t len) {
+    stream_.feed(data, len);
+}
+
+void FundingParser::finish() {
+    stream_.finish();
+}
+
+void FundingParser::emit(std::string_view object) {
+    // Open a zeroed row, then let the handler fill it in place
+    if (series_) {
+        series_->time.push_back(0);
+        series_->rate.push_back(0.0);
+        series_->premium.push_back(0.0);
+    } else {
+        user_->time.push_back(0);
+        user_->coin.push_back(0);
+        user_->usdc.push_back(0.0);
+        user_->szi.push_back(0.0);
+        user_->rate.push_back(0.0);
+    }
+
+    FundingHandler handler(series_, user_, symbols_);
+    if (!nlohmann::json::sax_parse(object.begin(), object.end(), &handler)) {
+        throw std::runtime_error("Failed to parse funding entry: " + handler.error());
+    }
+}
+
+// ---------------------------------------------------------------------------
+// FundingLoader
+// ---------------------------------------------------------------------------
+
+FundingLoader::FundingLoader(Info& info, size_t max_in_flight)
+    : info_(info), max_in_flight_(max_in_flight == 0 ? 1 : max_in_flight) {}
+
+std::vector<FundingSeries> FundingLoader::load(const std::vector<std::string>& names,
+                                               int64_t start_time,
+                                               int64_t end_time) {
+    std::vector<FundingSeries> results(names.size());
+    std::vector<FundingRequest> requests;
+    std::vector<size_t> owners;
+    for (size_t i = 0; i < names.size(); ++i) {
+        results[i].coin = info_.nameToCoin(names[i]);
+        requests.push_back({results[i].coin, start_time, end_time});
+        owners.push_back(i);
+    }
+
+    while (!requests.empty()) {
+        auto pages = info_.fundingHistoryMany(requests, max_in_flight_);
+
+        std::vector<FundingRequest> next_requests;
+        std::vector<size_t> next_owners;
+        for (size_t r = 0; r < pages.size(); ++r) {
+            FundingSeries& page = pages[r];
+            FundingSeries& series = results[owners[r]];
+
+            // Pages overlap on their boundary timestamp; one entry per time per coin
+            size_t first = 0;
+            while (first < page.size() && !series.empty() && page.time[first] <= series.time.back()) {
+                ++first;
+            }
+            series.time.insert(series.time.end(), page.time.begin() + first, page.time.end());
+            series.rate.insert(series.rate.end(), page.rate.begin() + first, page.rate.end());
+            series.premium.insert(series.premium.end(), page.premium.begin() + first, page.premium.end());
+
+            // A full page may have more at or after its last entry
+            if (page.size() >= PAGE_LIMIT && page.time.back() < end_time) {
+                next_requests.push_back({series.coin, nextPageStart(page.time, requests[r].start_time), end_time});
+                next_owners.push_back(owners[r]);
+            }
+        }
+        requests = std::move(next_requests);
+        owners = std::move(next_owners);
+    }
+    return results;
+}
+
+std::vector<UserFunding> FundingLoader::loadUsers(const std::vector<std::string>& addresses,
+                                                  int64_t start_time,
+                                                  int64_t end_time,
+                                                  SymbolTable& symbols) {
+    std::vector<UserFunding> results(addresses.size());
+    std::vector<UserFundingRequest> requests;
+    std::vector<size_t> owners;
+    for (size_t i = 0; i < addresses.size(); ++i) {
+        requests.push_back({addresses[i], start_time, end_time});
+        owners.push_back(i);
+    }
+
+    while (!requests.empty()) {
+        auto pages = info_.userFundingHistoryMany(requests, symbols, max_in_flight_);
+
+        std::vector<UserFundingRequest> next_requests;
+        std::vector<size_t> next_owners;
+        for (size_t r = 0; r < pages.size(); ++r) {
+            UserFunding& page = pages[r];
+            UserFunding& payments = results[owners[r]];
+
+            // All of a user's payments for an hour share one timestamp, so pages
+            // overlap on it; skip the (time, coin) pairs already taken
+            int64_t boundary = payments.empty() ? INT64_MIN : payments.time.back();
+            std::unordered_set<uint32_t> boundary_coins;
+            for (size_t i = payments.size(); i > 0 && payments.time[i - 1] == boundary; --i) {
+                boundary_coins.insert(payments.coin[i - 1]);
+            }
+            for (size_t i = 0; i < page.size(); ++i) {
+                if (page.time[i] < boundary ||
+                    (page.time[i] == boundary && boundary_coins.count(page.coin[i]))) {
+                    continue;
+                }
+                payments.time.push_back(page.time[i]);
+                payments.coin.push_back(page.coin[i]);
+                payments.usdc.push_back(page.usdc[i]);
+                payments.szi.push_back(page.szi[i]);
+                payments.rate.push_back(page.rate[i]);
+            }
+
+            if (page.size() >= PAGE_LIMIT && page.time.back() < end_time) {
+                next_requests.push_back({requests[r].user, nextPageStart(page.time, requests[r].start_time), end_time});
+                next_owners.push_back(owners[r]);
+            }
+        }
+        requests = std::move(next_requests);
+        owners = std::move(next_owners);
+    }
+    return results;
+}
+
+// ---------------------------------------------------------------------------
+// Aggregation
+// ---------------------------------------------------------------------------
+
+double cumulativeFunding(const FundingSeries& series, int64_t start_time, int64_t end_time) {
+    auto range = timeRange(series.time, start_time, end_time);
+    return sumRange(series.rate, range.first, range.second);
+}
+
+std::vector<double> cumulativeFundingSeries(const FundingSeries& series) {
+    std::vector<double> result(series.size());
+    double sum = 0.0;
+    for (size_t i = 0; i < series.size(); ++i) {
+        sum += series.rate[i];
+        result[i] = sum;
+    }
+    return result;
+}
+
+double annualizedFunding(const FundingSeries& series, int64_t start_time, int64_t end_time) {
+    auto range = timeRange(series.time, start_time, end_time);
+    size_t count = range.second - range.first;
+    if (count == 0) {
+        return 0.0;
+    }
+    return sumRange(series.rate, range.first, range.second) / count * HOURS_PER_YEAR;
+}
+
+std::vector<double> annualizedFunding(const std::vector<FundingSeries>& universe,
+                                      int64_t start_time,
+                                      int64_t end_time) {
+    std::vector<double> result(universe.size());
+    for (size_t i = 0; i < universe.size(); ++i) {
+        result[i] = annualizedFunding(universe[i], start_time, end_time);
+    }
+    return result;
+}
+
+double fundingPnl(const FundingSeries& series,
+                  double szi,
+                  double px,
+                  int64_t start_time,
+                  int64_t end_time) {
+    return -szi * px * cumulativeFunding(series, start_time, end_time);
+}
+
+std::vector<double> fundingPaidByCoin(const UserFunding& payments, const SymbolTable& symbols) {
+    std::vector<double> totals(symbols.size(), 0.0);
+    for (size_t i = 0; i < payments.size(); ++i) {
+        if (payments.coin[i] < totals.size()) {
+            totals[payments.coin[i]] += payments.usdc[i];
+        }
+    }
+    return totals;
+}
+
+} // namespace hyperliquid
@@ -1,5 +1,9 @@
 #include "hyperliquid/info.hpp"
 #include "hyperliquid/utils/constants.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/json_writer.hpp"
+#include "hyperliquid/utils/latency.hpp"
+#include <memory>
 #include <stdexcept>
 
 namespace hyperliquid {
@@ -119,6 +123,8 @@ void Info::registerSpotMeta(const SpotMeta& spot_meta) {
 }
 
 int Info::nameToAsset(const std::string& name) const {
+    HYPERLIQUID_LATENCY_SCOPE(NameResolution);
+
     auto it = name_to_coin_.find(name);
     if (it == name_to_coin_.end()) {
         throw std::runtime_error("Unknown asset name: " + name);
@@ -152,6 +158,122 @@ nlohmann::json Info::userState(const std::string& address, const std::string& de
     return post("/info", payload);
 }
 
+void Info::userState(const std::string& address,
+                     ClearinghouseState& state,
+                     const std::string& dex) {
+    static const std::string REQUEST_TYPE = "clearinghouseState";
+
+    request_buffer_.assign(R"({"type":"clearinghouseState","user":)");
+    appendJsonString(request_buffer_, address);
+    if (!dex.empty()) {
+        request_buffer_ += R"(,"dex":)";
+        appendJsonString(request_buffer_, dex);
+    }
+    request_buffer_ += '}';
+
+    postBodyRaw("/info", request_buffer_, REQUEST_TYPE, 0, response_buffer_);
+
+    HYPERLIQUID_LATENCY_SCOPE(JsonParse);
+    parseClearinghouseState(response_buffer_, coin_to_asset_, state);
+}
+
+namespace {
+
+enum class AccountQuery {
+    UserState,
+    OpenOrders,
+    SpotState
+};
+
+const char* accountQueryType(AccountQuery query) {
+    switch (query) {
+        case AccountQuery::UserState: return "clearinghouseState";
+        case AccountQuery::OpenOrders: return "openOrders";
+        case AccountQuery::SpotState: return "spotClearinghouseState";
+    }
+    return "";
+}
+
+nlohmann::json accountPayload(const AccountRequest& request, AccountQuery query) {
+    nlohmann::json payload = {
+        {"type", accountQueryType(query)},
+        {"user", request.user}
+    };
+    // Spot state is shared by all perp dexes
+    if (query != AccountQuery::SpotState && !request.dex.empty()) {
+        payload["dex"] = request.dex;
+    }
+    return payload;
+}
+
+} // namespace
+
+void Info::accountSnapshots(const std::vector<AccountRequest>& requests,
+                            std::vector<AccountSnapshot>& snapshots,
+                            size_t max_in_flight) {
+    struct Query {
+        size_t account;
+        AccountQuery kind;
+    };
+    std::vector<Query> queries;
+    std::vector<nlohmann::json> payloads;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        const AccountRequest& request = requests[i];
+        if (request.user_state) {
+            queries.push_back({i, AccountQuery::UserState});
+        }
+        if (request.open_orders) {
+            queries.push_back({i, AccountQuery::OpenOrders});
+        }
+        if (request.spot_state) {
+            queries.push_back({i, AccountQuery::SpotState});
+        }
+    }
+    payloads.reserve(queries.size());
+    for (const Query& query : queries) {
+        payloads.push_back(accountPayload(requests[query.account], query.kind));
+    }
+
+    if (batch_buffers_.size() < queries.size()) {
+        batch_buffers_.resize(queries.size());
+    }
+    for (size_t i = 0; i < queries.size(); ++i) {
+        batch_buffers_[i].clear();
+    }
+
+    postManyStream("/info", payloads, [this](size_t index, const char* data, size_t len) {
+        batch_buffers_[index].append(data, len);
+    }, max_in_flight);
+
+    snapshots.resize(requests.size());
+    for (auto& snapshot : snapshots) {
+        snapshot.clear();
+    }
+
+    HYPERLIQUID_LATENCY_SCOPE(JsonParse);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        AccountSnapshot& snapshot = snapshots[queries[i].account];
+        switch (queries[i].kind) {
+            case AccountQuery::UserState:
+                parseClearinghouseState(batch_buffers_[i], coin_to_asset_, snapshot.state);
+                break;
+            case AccountQuery::OpenOrders:
+                parseOpenOrders(batch_buffers_[i], coin_to_asset_, snapshot.open_orders);
+                break;
+            case AccountQuery::SpotState:
+                parseSpotBalances(batch_buffers_[i], snapshot.spot_balances);
+                break;
+        }
+    }
+}
+
+std::vector<AccountSnapshot> Info::accountSnapshots(const std::vector<AccountRequest>& requests,
+                                                    size_t max_in_flight) {
+    std::vector<AccountSnapshot> snapshots;
+    accountSnapshots(requests, snapshots, max_in_flight);
+    return snapshots;
+}
+
 nlohmann::json Info::spotUserState(const std::string& address) {
     nlohmann::json payload = {
         {"type", "spotClearinghouseState"},
@@ -192,6 +314,80 @@ nlohmann::json Info::allMids(const std::string& dex) {
     return post("/info", payload);
 }
 
+void Info::storeMids(const nlohmann::json& mids) {
+    int64_t now = getTimestampMs();
+
+    std::lock_guard<std::mutex> lock(mids_mutex_);
+    for (auto it = mids.begin(); it != mids.end(); ++it) {
+        if (!it.value().is_string()) {
+            continue;
+        }
+        double px = fixedToDouble(decimalToFixed(it.value().get_ref<const std::string&>()));
+        mids_[it.key()] = CachedMid{px, now};
+    }
+}
+
+void Info::refreshMids(const std::string& dex) {
+    storeMids(allMids(dex));
+}
+
+void Info::applyAllMids(const nlohmann::json& msg) {
+    // Stream messages wrap the mids as {"channel": "allMids", "data": {"mids": {...}}}
+    const nlohmann::json& data = msg.contains("data") ? msg["data"] : msg;
+    storeMids(data.contains("mids") ? data["mids"] : data);
+}
+
+std::optional<double> Info::cachedMid(const std::string& name) const {
+    auto coin_it = name_to_coin_.find(name);
+    const std::string& coin = coin_it != name_to_coin_.end() ? coin_it->second : name;
+    int64_t now = getTimestampMs();
+
+    std::lock_guard<std::mutex> lock(mids_mutex_);
+    auto it = mids_.find(coin);
+    if (it == mids_.end() || now - it->second.updated_ms > mid_staleness_ms_) {
+        return std::nullopt;
+    }
+    return it->second.px;
+}
+
+std::optional<double> Info::freshBookMid(const std::string& coin) const {
+    int64_t now = getTimestampMs();
+
+    std::lock_guard<std::mutex> lock(books_mutex_);
+    auto it = order_books_.find(coin);
+    if (it == order_books_.end() || now - it->second.updatedMs() > mid_staleness_ms_) {
+        return std::nullopt;
+    }
+    return it->second.mid();
+}
+
+double Info::midPrice(const std::string& name) {
+    const std::string& coin = nameToCoin(name);
+
+    auto mid = freshBookMid(coin);
+    if (mid.has_value()) {
+        return mid.value();
+    }
+
+    auto cached = cachedMid(coin);
+    if (cached.has_value()) {
+        return cached.value();
+    }
+
+    // Builder-deployed perps are named "dex:COIN" and only priced by their dex's allMids
+    size_t separator = coin.find(':');
+    refreshMids(separator == std::string::npos ? std::string() : coin.substr(0, separator));
+    cached = cachedMid(coin);
+    if (!cached.has_value()) {
+        throw std::runtime_error("No mid price available for " + coin);
+    }
+    return cached.value();
+}
+
+void Info::setMidStaleness(std::chrono::milliseconds max_age) {
+    mid_staleness_ms_ = max_age.count();
+}
+
 nlohmann::json Info::userFills(const std::string& address) {
     nlohmann::json payload = {
         {"type", "userFills"},
@@ -214,6 +410,154 @@ nlohmann::json Info::userFillsByTime(const std::string& address,
     return post("/info", payload);
 }
 
+size_t Info::userFillsStream(const std::string& address,
+                             SymbolTable& symbols,
+                             const FillCallback& on_fill) {
+    nlohmann::json payload = {
+        {"type", "userFills"},
+        {"user", address}
+    };
+
+    FillParser parser(symbols, on_fill);
+    postStream("/info", payload, [&parser](const char* data, size_t len) {
+        parser.feed(data, len);
+    });
+    parser.finish();
+    return parser.count();
+}
+
+size_t Info::userFillsByTimeStream(const std::string& address,
+                                   int64_t start_time,
+                                   std::optional<int64_t> end_time,
+                                   SymbolTable& symbols,
+                                   const FillCallback& on_fill) {
+    nlohmann::json payload = {
+        {"type", "userFillsByTime"},
+        {"user", address},
+        {"startTime", start_time}
+    };
+    if (end_time.has_value()) {
+        payload["endTime"] = end_time.value();
+    }
+
+    FillParser parser(symbols, on_fill);
+    postStream("/info", payload, [&parser](const char* data, size_t len) {
+        parser.feed(data, len);
+    });
+    parser.finish();
+    return parser.count();
+}
+
+void Info::userFillsByTimeWindows(const std::string& address,
+                                  const std::vector<std::pair<int64_t, int64_t>>& windows,
+                                  SymbolTable& symbols,
+                                  const WindowFillCallback& on_fill,
+                                  size_t max_in_flight) {
+    std::vector<nlohmann::json> payloads;
+    std::vector<std::unique_ptr<FillParser>> parsers;
+    payloads.reserve(windows.size());
+    parsers.reserve(windows.size());
+    for (size_t i = 0; i < windows.size(); ++i) {
+        payloads.push_back({
+            {"type", "userFillsByTime"},
+            {"user", address},
+            {"startTime", windows[i].first},
+            {"endTime", windows[i].second}
+        });
+        parsers.push_back(std::make_unique<FillParser>(symbols, [&on_fill, i](const Fill& fill) {
+            on_fill(i, fill);
+        }));
+    }
+
+    postManyStream("/info", payloads, [&parsers](size_t index, const char* data, size_t len) {
+        parsers[index]->feed(data, len);
+    }, max_in_flight);
+
+    for (auto& parser : parsers) {
+        parser->finish();
+    }
+}
+
+nlohmann::json Info::fundingHistory(const std::string& name,
+                                    int64_t start_time,
+                                    std::optional<int64_t> end_time) {
+    nlohmann::json payload = {
+        {"type", "fundingHistory"},
+        {"coin", nameToCoin(name)},
+        {"startTime", start_time}
+    };
+    if (end_time.has_value()) {
+        payload["endTime"] = end_time.value();
+    }
+    return post("/info", payload);
+}
+
+nlohmann::json Info::userFundingHistory(const std::string& user,
+                                        int64_t start_time,
+                                        std::optional<int64_t> end_time) {
+    nlohmann::json payload = {
+        {"type", "userFunding"},
+        {"user", user},
+        {"startTime", start_time}
+    };
+    if (end_time.has_value()) {
+        payload["endTime"] = end_time.value();
+    }
+    return post("/info", payload);
+}
+
+std::vector<FundingSeries> Info::fundingHistoryMany(const std::vector<FundingRequest>& requests,
+                                                    size_t max_in_flight) {
+    std::vector<FundingSeries> results(requests.size());
+    std::vector<nlohmann::json> payloads;
+    std::vector<std::unique_ptr<FundingParser>> parsers;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        results[i].coin = requests[i].coin;
+        payloads.push_back({
+            {"type", "fundingHistory"},
+            {"coin", requests[i].coin},
+            {"startTime", requests[i].start_time},
+            {"endTime", requests[i].end_time}
+        });
+        parsers.push_back(std::make_unique<FundingParser>(results[i]));
+    }
+
+    postManyStream("/info", payloads, [&parsers](size_t index, const char* data, size_t len) {
+        parsers[index]->feed(data, len);
+    }, max_in_flight);
+
+    for (auto& parser : parsers) {
+        parser->finish();
+    }
+    return results;
+}
+
+std::vector<UserFunding> Info::userFundingHistoryMany(const std::vector<UserFundingRequest>& requests,
+                                                      SymbolTable& symbols,
+                                                      size_t max_in_flight) {
+    std::vector<UserFunding> results(requests.size());
+    std::vector<nlohmann::json> payloads;
+    std::vector<std::unique_ptr<FundingParser>> parsers;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        payloads.push_back({
+            {"type", "userFunding"},
+            {"user", requests[i].user},
+            {"startTime", requests[i].start_time},
+            {"endTime", requests[i].end_time}
+        });
+        parsers.push_back(std::make_unique<FundingParser>(results[i], symbols));
+    }
+
+    postManyStream("/info", payloads, [&parsers](size_t index, const char* data, size_t len) {
+        parsers[index]->feed(data, len);
+    }, max_in_flight);
+
+    for (auto& parser : parsers) {
+        parser->finish();
+    }
+    return results;
+}
+
 Meta Info::meta(const std::string& dex) {
     nlohmann::json payload = {
         {"type", "meta"}
@@ -277,6 +621,90 @@ nlohmann::json Info::l2Snapshot(const std::string& name) {
     return post("/info", payload);
 }
 
+namespace {
+
+nlohmann::json candleSnapshotPayload(const CandleRequest& request) {
+    return {
+        {"type", "candleSnapshot"},
+        {"req", {
+            {"coin", request.coin},
+            {"interval", request.interval},
+            {"startTime", request.start_time},
+            {"endTime", request.end_time}
+        }}
+    };
+}
+
+} // namespace
+
+Candles Info::candlesSnapshot(const std::string& name,
+                              const std::string& interval,
+                              int64_t start_time,
+                              int64_t end_time) {
+    CandleRequest request{nameToCoin(name), interval, start_time, end_time};
+
+    Candles candles;
+    CandleParser parser(candles);
+    postStream("/info", candleSnapshotPayload(request), [&parser](const char* data, size_t len) {
+        parser.feed(data, len);
+    });
+    parser.finish();
+    return candles;
+}
+
+std::vector<Candles> Info::candlesSnapshotMany(const std::vector<CandleRequest>& requests,
+                                               size_t max_in_flight) {
+    std::vector<Candles> results(requests.size());
+    std::vector<nlohmann::json> payloads;
+    std::vector<std::unique_ptr<CandleParser>> parsers;
+    payloads.reserve(requests.size());
+    parsers.reserve(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        payloads.push_back(candleSnapshotPayload(requests[i]));
+        parsers.push_back(std::make_unique<CandleParser>(results[i]));
+    }
+
+    postManyStream("/info", payloads, [&parsers](size_t index, const char* data, size_t len) {
+        parsers[index]->feed(data, len);
+    }, max_in_flight);
+
+    for (auto& parser : parsers) {
+        parser->finish();
+    }
+    return results;
+}
+
+const OrderBook& Info::syncOrderBook(const std::string& name) {
+    const std::string& coin = nameToCoin(name);
+    auto snapshot = l2Snapshot(coin);
+
+    std::lock_guard<std::mutex> lock(books_mutex_);
+    auto it = order_books_.try_emplace(coin, coin).first;
+    it->second.applySnapshot(snapshot);
+    return it->second;
+}
+
+void Info::applyL2Book(const nlohmann::json& msg) {
+    const nlohmann::json& data = msg.contains("data") ? msg["data"] : msg;
+    const std::string& coin = data["coin"].get_ref<const std::string&>();
+
+    std::lock_guard<std::mutex> lock(books_mutex_);
+    auto it = order_books_.try_emplace(coin, coin).first;
+    it->second.applySnapshot(data);
+}
+
+const OrderBook* Info::orderBook(const std::string& name) const {
+    auto coin_it = name_to_coin_.find(name);
+    const std::string& coin = coin_it != name_to_coin_.end() ? coin_it->second : name;
+
+    std::lock_guard<std::mutex> lock(books_mutex_);
+    auto it = order_books_.find(coin);
+    if (it == order_books_.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
 nlohmann::json Info::queryOrderByOid(const std::string& user, int64_t oid) {
     nlohmann::json payload = {
         {"type", "orderStatus"},
@@ -0,0 +1,460 @@
+#include "hyperliquid/journal.hpp"
+#include "hyperliquid/fill_history.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hyperliquid {
+
+namespace {
+
+constexpr char JOURNAL_MAGIC[8] = {'H', 'L', 'J', 'R', 'N', 'L', '\0', '\0'};
+constexpr uint32_t JOURNAL_VERSION = 1;
+
+/**
+ * First 128 bytes of every journal file
+ */
+struct JournalHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint8_t reserved[112];
+};
+
+static_assert(sizeof(JournalHeader) == sizeof(JournalRecord), "Header must be one record long");
+
+JournalRecord emptyRecord(JournalRecordType type) {
+    JournalRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.type = type;
+    return record;
+}
+
+void checkHeader(const JournalHeader& header, const std::string& path) {
+    if (std::memcmp(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 ||
+        header.version != JOURNAL_VERSION ||
+        header.record_size != sizeof(JournalRecord)) {
+        throw std::runtime_error("Not a compatible journal file: " + path);
+    }
+}
+
+std::string_view symbolName(const JournalRecord& record) {
+    return std::string_view(record.name, strnlen(record.name, sizeof(record.name)));
+}
+
+[[noreturn]] void throwSystemError(const std::string& what, const std::string& path) {
+    throw std::runtime_error(what + " failed for journal " + path + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// JournalWriter
+// ---------------------------------------------------------------------------
+
+JournalWriter::JournalWriter(const std::string& path) : path_(path) {
+#ifdef _WIN32
+    throw std::runtime_error("Journals are not supported on Windows");
+#else
+    fd_ = ::open(path_.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+    if (fd_ < 0) {
+        throwSystemError("open", path_);
+    }
+    try {
+        recover();
+    } catch (...) {
+        ::close(fd_);
+        throw;
+    }
+    buffer_.reserve(BUFFERED_RECORDS);
+#endif
+}
+
+JournalWriter::~JournalWriter() {
+#ifndef _WIN32
+    if (fd_ >= 0) {
+        try {
+            flush();
+        } catch (...) {
+            // Nothing sensible to do in a destructor
+        }
+        ::close(fd_);
+    }
+#endif
+}
+
+void JournalWriter::recover() {
+#ifndef _WIN32
+    struct stat info;
+    if (::fstat(fd_, &info) != 0) {
+        throwSystemError("fstat", path_);
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+
+    if (size < sizeof(JournalHeader)) {
+        // New (or torn before the header was complete): start over
+        if (::ftruncate(fd_, 0) != 0) {
+            throwSystemError("ftruncate", path_);
+        }
+        JournalHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+        header.version = JOURNAL_VERSION;
+        header.record_size = sizeof(JournalRecord);
+        if (::write(fd_, &header, sizeof(header)) != static_cast<ssize_t>(sizeof(header))) {
+            throwSystemError("write", path_);
+        }
+        return;
+    }
+
+    JournalHeader header;
+    if (::pread(fd_, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        throwSystemError("read", path_);
+    }
+    checkHeader(header, path_);
+
+    // Drop a partially written trailing record
+    size_t whole = size - (size - sizeof(JournalHeader)) % sizeof(JournalRecord);
+    if (whole != size && ::ftruncate(fd_, static_cast<off_t>(whole)) != 0) {
+        throwSystemError("ftruncate", path_);
+    }
+
+    // Rebuild the symbol table and the last fill timestamp
+    std::vector<JournalRecord> chunk(1024);
+    for (size_t offset = sizeof(JournalHeader); offset < whole;) {
+        size_t bytes = std::min(whole - offset, chunk.size() * sizeof(JournalRecord));
+        if (::pread(fd_, chunk.data(), bytes, static_cast<off_t>(offset)) != static_cast<ssize_t>(bytes)) {
+            throwSystemError("read", path_);
+        }
+        for (size_t i = 0; i < bytes / sizeof(JournalRecord); ++i) {
+            const JournalRecord& record = chunk[i];
+            if (record.type == JournalRecordType::Symbol) {
+                if (symbols_.intern(symbolName(record)) != record.coin) {
+                    throw std::runtime_error("Corrupt symbol table in journal " + path_);
+                }
+            } else if (record.type == JournalRecordType::Fill) {
+                if (record.time > last_fill_time_) {
+                    last_fill_time_ = record.time;
+                    last_fill_keys_.clear();
+                }
+                if (record.time == last_fill_time_) {
+                    FillKey key;
+                    key.first = record.fill.tid;
+                    std::memcpy(key.second.data(), record.fill.hash, key.second.size());
+                    last_fill_keys_.insert(key);
+                }
+            }
+        }
+        offset += bytes;
+    }
+#endif
+}
+
+uint32_t JournalWriter::symbolLocked(std::string_view name) {
+    uint32_t id;
+    if (symbols_.find(name, id)) {
+        return id;
+    }
+    if (name.size() > sizeof(JournalRecord::name)) {
+        throw std::invalid_argument("Symbol name too long for journal: " + std::string(name));
+    }
+    id = symbols_.intern(name);
+
+    JournalRecord record = emptyRecord(JournalRecordType::Symbol);
+    record.coin = id;
+    std::memcpy(record.name, name.data(), name.size());
+    pushLocked(record);
+    return id;
+}
+
+void JournalWriter::pushLocked(const JournalRecord& record) {
+    buffer_.push_back(record);
+    if (buffer_.size() >= BUFFERED_RECORDS) {
+        flushLocked();
+    }
+}
+
+void JournalWriter::flushLocked() {
+#ifndef _WIN32
+    const char* data = reinterpret_cast<const char*>(buffer_.data());
+    size_t remaining = buffer_.size() * sizeof(JournalRecord);
+    while (remaining > 0) {
+        ssize_t written = ::write(fd_, data, remaining);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throwSystemError("write", path_);
+        }
+        data += written;
+        remaining -= static_cast<size_t>(written);
+    }
+#endif
+    buffer_.clear();
+}
+
+void JournalWriter::flush(bool durable) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushLocked();
+#ifndef _WIN32
+    if (durable && ::fsync(fd_) != 0) {
+        throwSystemError("fsync", path_);
+    }
+#endif
+}
+
+void JournalWriter::appendFill(const Fill& fill, const SymbolTable& symbols) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    JournalRecord record = emptyRecord(JournalRecordType::Fill);
+    record.coin = symbolLocked(symbols.name(fill.coin));
+    record.fill.dir = symbolLocked(symbols.name(fill.dir));
+    record.fill.fee_token = symbolLocked(symbols.name(fill.fee_token));
+    record.side = static_cast<uint8_t>(fill.side);
+    record.flags = fill.crossed ? JournalRecord::FLAG_CROSSED : 0;
+    record.time = fill.time;
+    record.oid = fill.oid;
+    record.px = fill.px;
+    record.sz = fill.sz;
+    if (fill.cloid.has_value()) {
+        record.flags |= JournalRecord::FLAG_HAS_CLOID;
+        record.cloid_hi = fill.cloid->hi();
+        record.cloid_lo = fill.cloid->lo();
+    }
+    record.fill.tid = fill.tid;
+    record.fill.fee = fill.fee;
+    record.fill.closed_pnl = fill.closed_pnl;
+    record.fill.start_position = fill.start_position;
+    std::memcpy(record.fill.hash, fill.hash.data(), fill.hash.size());
+    pushLocked(record);
+
+    if (fill.time > last_fill_time_) {
+        last_fill_time_ = fill.time;
+        last_fill_keys_.clear();
+    }
+    if (fill.time == last_fill_time_) {
+        last_fill_keys_.insert(fillKey(fill));
+    }
+}
+
+void JournalWriter::appendOrder(const TrackedOrder& order) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    JournalRecord record = emptyRecord(JournalRecordType::Order);
+    record.coin = symbolLocked(order.coin);
+    record.side = static_cast<uint8_t>(order.is_buy ? Side::Buy : Side::Sell);
+    record.state = static_cast<uint8_t>(order.state);
+    record.time = order.updated_ms;
+    record.oid = order.oid;
+    record.px = doubleToFixed(order.limit_px);
+    record.sz = doubleToFixed(order.sz);
+    if (order.cloid.has_value()) {
+        record.flags |= JournalRecord::FLAG_HAS_CLOID;
+        record.cloid_hi = order.cloid->hi();
+        record.cloid_lo = order.cloid->lo();
+    }
+    record.order.orig_sz = doubleToFixed(order.orig_sz);
+    record.order.asset = order.asset;
+    pushLocked(record);
+}
+
+int64_t JournalWriter::lastFillTime() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_fill_time_;
+}
+
+size_t JournalWriter::syncFills(FillHistory& history,
+                                const std::string& address,
+                                int64_t end_time,
+                                std::optional<int64_t> start_time) {
+    int64_t from;
+    std::set<FillKey> seen;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        from = last_fill_time_;
+        seen = last_fill_keys_;
+    }
+    if (from == 0) {
+        if (!start_time.has_value()) {
+            throw std::invalid_argument("syncFills needs a start_time while the journal holds no fills");
+        }
+        from = *start_time;
+    }
+    if (end_time < from) {
+        return 0;
+    }
+
+    SymbolTable symbols;
+    size_t appended = 0;
+    history.fetch(address, from, end_time, symbols, [&](const Fill& fill) {
+        if (fill.time == from && seen.count(fillKey(fill))) {
+            return;  // already journaled
+        }
+        appendFill(fill, symbols);
+        ++appended;
+    });
+    flush();
+    return appended;
+}
+
+// ---------------------------------------------------------------------------
+// JournalReader
+// ---------------------------------------------------------------------------
+
+JournalReader::JournalReader(const std::string& path) {
+#ifdef _WIN32
+    (void)path;
+    throw std::runtime_error("Journals are not supported on Windows");
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throwSystemError("open", path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throwSystemError("fstat", path);
+    }
+    mapping_size_ = static_cast<size_t>(info.st_size);
+    if (mapping_size_ < sizeof(JournalHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Journal file is too short: " + path);
+    }
+
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        throwSystemError("mmap", path);
+    }
+
+    try {
+        checkHeader(*static_cast<const JournalHeader*>(mapping_), path);
+    } catch (...) {
+        ::munmap(mapping_, mapping_size_);
+        throw;
+    }
+
+    // A torn trailing record is ignored
+    records_ = reinterpret_cast<const JournalRecord*>(
+        static_cast<const char*>(mapping_) + sizeof(JournalHeader));
+    record_count_ = (mapping_size_ - sizeof(JournalHeader)) / sizeof(JournalRecord);
+#endif
+
+    for (size_t i = 0; i < record_count_; ++i) {
+        const JournalRecord& record = records_[i];
+        if (record.type == JournalRecordType::Symbol) {
+            symbols_.intern(symbolName(record));
+            by_coin_.resize(symbols_.size());
+        } else if (record.type == JournalRecordType::Fill && record.coin < by_coin_.size()) {
+            by_time_.push_back(static_cast<uint32_t>(i));
+            by_coin_[record.coin].push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    auto by_record_time = [this](uint32_t a, uint32_t b) {
+        return records_[a].time < records_[b].time;
+    };
+    std::stable_sort(by_time_.begin(), by_time_.end(), by_record_time);
+    for (auto& index : by_coin_) {
+        std::stable_sort(index.begin(), index.end(), by_record_time);
+    }
+}
+
+JournalReader::~JournalReader() {
+#ifndef _WIN32
+    if (mapping_) {
+        ::munmap(mapping_, mapping_size_);
+    }
+#endif
+}
+
+int64_t JournalReader::lastFillTime() const {
+    return by_time_.empty() ? 0 : records_[by_time_.back()].time;
+}
+
+Fill JournalReader::toFill(const JournalRecord& record) const {
+    Fill fill;
+    fill.coin = record.coin;
+    fill.side = static_cast<Side>(record.side);
+    fill.crossed = (record.flags & JournalRecord::FLAG_CROSSED) != 0;
+    fill.px = record.px;
+    fill.sz = record.sz;
+    fill.fee = record.fill.fee;
+    fill.closed_pnl = record.fill.closed_pnl;
+    fill.start_position = record.fill.start_position;
+    fill.time = record.time;
+    fill.oid = record.oid;
+    fill.tid = record.fill.tid;
+    fill.dir = record.fill.dir;
+    fill.fee_token = record.fill.fee_token;
+    std::memcpy(fill.hash.data(), record.fill.hash, fill.hash.size());
+    if (record.flags & JournalRecord::FLAG_HAS_CLOID) {
+        fill.cloid = Cloid(record.cloid_hi, record.cloid_lo);
+    }
+    return fill;
+}
+
+void JournalReader::scan(const std::vector<uint32_t>& index,
+                         int64_t start_time,
+                         int64_t end_time,
+                         const FillCallback& on_fill) const {
+    auto it = std::lower_bound(index.begin(), index.end(), start_time,
+        [this](uint32_t position, int64_t time) {
+            return records_[position].time < time;
+        });
+    for (; it != index.end() && records_[*it].time <= end_time; ++it) {
+        on_fill(toFill(records_[*it]));
+    }
+}
+
+void JournalReader::fillsBetween(int64_t start_time,
+                                 int64_t end_time,
+                                 const FillCallback& on_fill) const {
+    scan(by_time_, start_time, end_time, on_fill);
+}
+
+void JournalReader::fillsForCoin(const std::string& coin,
+                                 int64_t start_time,
+                                 int64_t end_time,
+                                 const FillCallback& on_fill) const {
+    uint32_t id;
+    if (!symbols_.find(coin, id)) {
+        return;
+    }
+    scan(by_coin_[id], start_time, end_time, on_fill);
+}
+
+void JournalReader::orderEvents(const std::function<void(const TrackedOrder&)>& on_order) const {
+    for (size_t i = 0; i < record_count_; ++i) {
+        const JournalRecord& record = records_[i];
+        if (record.type != JournalRecordType::Order) {
+            continue;
+        }
+        TrackedOrder order;
+        order.oid = record.oid;
+        if (record.flags & JournalRecord::FLAG_HAS_CLOID) {
+            order.cloid = Cloid(record.cloid_hi, record.cloid_lo);
+        }
+        order.asset = record.order.asset;
+        order.coin = symbols_.name(record.coin);
+        order.is_buy = static_cast<Side>(record.side) == Side::Buy;
+        order.limit_px = fixedToDouble(record.px);
+        order.sz = fixedToDouble(record.sz);
+        order.orig_sz = fixedToDouble(record.order.orig_sz);
+        order.state = static_cast<OrderState>(record.state);
+        order.updated_ms = record.time;
+        on_order(order);
+    }
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,177 @@
+#include "hyperliquid/order_batcher.hpp"
+#include "hyperliquid/exchange.hpp"
+#include <stdexcept>
+
+namespace hyperliquid {
+
+OrderBatcher::OrderBatcher(Exchange& exchange,
+                           std::chrono::microseconds window,
+                           size_t max_batch,
+                           const std::optional<BuilderInfo>& builder)
+    : exchange_(exchange),
+      window_(window),
+      max_batch_(max_batch == 0 ? 1 : max_batch),
+      builder_(builder) {
+    worker_ = std::thread(&OrderBatcher::run, this);
+}
+
+OrderBatcher::~OrderBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+template <typename Request>
+std::future<OrderStatus> OrderBatcher::enqueue(const Request& request) {
+    std::future<OrderStatus> future;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            throw std::runtime_error("OrderBatcher is stopping");
+        }
+        if (batches_.empty()) {
+            first_pending_ = std::chrono::steady_clock::now();
+        }
+
+        // A different kind of action or a full one starts a new batch
+        auto* open = batches_.empty() ? nullptr : std::get_if<Pending<Request>>(&batches_.back());
+        if (open == nullptr || open->size() >= max_batch_) {
+            batches_.emplace_back(Pending<Request>());
+            open = &std::get<Pending<Request>>(batches_.back());
+        }
+        open->requests.push_back(request);
+        open->promises.emplace_back();
+        future = open->promises.back().get_future();
+    }
+    cv_.notify_one();
+    return future;
+}
+
+std::future<OrderStatus> OrderBatcher::submitOrder(const OrderRequest& order) {
+    return enqueue(order);
+}
+
+std::future<OrderStatus> OrderBatcher::submitCancel(const CancelRequest& cancel) {
+    return enqueue(cancel);
+}
+
+std::future<OrderStatus> OrderBatcher::submitCancelByCloid(const CancelByCloidRequest& cancel) {
+    return enqueue(cancel);
+}
+
+std::future<OrderStatus> OrderBatcher::submitModify(const ModifyRequest& modify) {
+    return enqueue(modify);
+}
+
+void OrderBatcher::flush() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (batches_.empty()) {
+            return;  // A stale request would cut the next batch's window short
+        }
+        flush_requested_ = true;
+    }
+    cv_.notify_one();
+}
+
+bool OrderBatcher::batchClosedLocked() const {
+    if (batches_.size() > 1) {
+        return true;
+    }
+    return std::visit([this](const auto& batch) { return batch.size() >= max_batch_; }, batches_.front());
+}
+
+void OrderBatcher::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return stopping_ || !batches_.empty(); });
+        if (stopping_ && batches_.empty()) {
+            return;
+        }
+
+        // Hold the batch open until the window closes or a batch is closed
+        cv_.wait_until(lock, first_pending_ + window_, [this] {
+            return stopping_ || flush_requested_ || batchClosedLocked();
+        });
+        flush_requested_ = false;
+
+        lock.unlock();
+        send();
+        lock.lock();
+    }
+}
+
+template <typename Request, typename SendFn>
+void OrderBatcher::dispatch(Pending<Request>& batch, SendFn send_fn) {
+    if (batch.empty()) {
+        return;
+    }
+
+    try {
+        send_fn(batch.requests, response_);
+        if (!response_.ok) {
+            throw std::runtime_error("Batched action failed: " + response_.error);
+        }
+
+        for (size_t i = 0; i < batch.promises.size(); ++i) {
+            if (i < response_.statuses.size()) {
+                batch.promises[i].set_value(std::move(response_.statuses[i]));
+            } else {
+                batch.promises[i].set_exception(std::make_exception_ptr(
+                    std::runtime_error("Missing status in batched response")));
+            }
+        }
+    } catch (...) {
+        auto error = std::current_exception();
+        for (auto& promise : batch.promises) {
+            try {
+                promise.set_exception(error);
+            } catch (const std::future_error&) {
+                // Already satisfied
+            }
+        }
+    }
+}
+
+void OrderBatcher::send() {
+    std::deque<Batch> batches;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::swap(batches, batches_);
+    }
+
+    for (auto& batch : batches) {
+        std::visit([this](auto& pending) { sendBatch(pending); }, batch);
+    }
+}
+
+void OrderBatcher::sendBatch(Pending<OrderRequest>& batch) {
+    dispatch(batch, [this](const std::vector<OrderRequest>& requests, ActionResponse& response) {
+        exchange_.bulkOrders(requests, response, builder_);
+    });
+}
+
+void OrderBatcher::sendBatch(Pending<CancelRequest>& batch) {
+    dispatch(batch, [this](const std::vector<CancelRequest>& requests, ActionResponse& response) {
+        exchange_.bulkCancel(requests, response);
+    });
+}
+
+void OrderBatcher::sendBatch(Pending<CancelByCloidRequest>& batch) {
+    dispatch(batch, [this](const std::vector<CancelByCloidRequest>& requests, ActionResponse& response) {
+        exchange_.bulkCancelByCloid(requests, response);
+    });
+}
+
+void OrderBatcher::sendBatch(Pending<ModifyRequest>& batch) {
+    dispatch(batch, [this](const std::vector<ModifyRequest>& requests, ActionResponse& response) {
+        exchange_.bulkModifyOrders(requests, response);
+    });
+}
+
+} // namespace hyperliquid
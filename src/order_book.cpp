@@ -0,0 +1,174 @@
+#include "hyperliquid/order_book.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace hyperliquid {
+
+OrderBook::OrderBook(std::string coin) : coin_(std::move(coin)) {}
+
+void OrderBook::parseSide(const nlohmann::json& levels, std::vector<Level>& out, bool is_bid) {
+    out.clear();
+    out.reserve(levels.size());
+
+    // Wire levels are ordered best first; store them best last
+    for (auto it = levels.rbegin(); it != levels.rend(); ++it) {
+        const auto& level = *it;
+        Level parsed;
+        parsed.px = decimalToFixed(level["px"].get_ref<const std::string&>());
+        parsed.sz = decimalToFixed(level["sz"].get_ref<const std::string&>());
+        parsed.n = level.value("n", 0);
+        out.push_back(parsed);
+    }
+
+    // Guard against unsorted input so the back is always the best level
+    auto better = [is_bid](const Level& a, const Level& b) {
+        return is_bid ? a.px < b.px : a.px > b.px;
+    };
+    if (!std::is_sorted(out.begin(), out.end(), better)) {
+        std::sort(out.begin(), out.end(), better);
+    }
+}
+
+void OrderBook::applySnapshot(const nlohmann::json& book) {
+    const nlohmann::json& data = book.contains("data") ? book["data"] : book;
+
+    if (!data.contains("levels") || data["levels"].size() != 2) {
+        throw std::runtime_error("Invalid l2Book message: missing levels");
+    }
+
+    if (data.contains("coin")) {
+        const auto& coin = data["coin"].get_ref<const std::string&>();
+        if (!coin_.empty() && coin != coin_) {
+            throw std::runtime_error("l2Book message for " + coin + " applied to book " + coin_);
+        }
+        coin_ = coin;
+    }
+
+    parseSide(data["levels"][0], bids_, true);
+    parseSide(data["levels"][1], asks_, false);
+
+    time_ = data.value("time", int64_t{0});
+    updated_ms_ = getTimestampMs();
+}
+
+void OrderBook::updateLevel(bool is_bid, double px, double sz, int n) {
+    std::vector<Level>& side = is_bid ? bids_ : asks_;
+    int64_t key = doubleToFixed(px);
+
+    auto it = std::lower_bound(side.begin(), side.end(), key,
+        [is_bid](const Level& level, int64_t value) {
+            return is_bid ? level.px < value : level.px > value;
+        });
+
+    if (sz <= 0.0) {
+        if (it != side.end() && it->px == key) {
+            side.erase(it);
+        }
+    } else if (it != side.end() && it->px == key) {
+        it->sz = doubleToFixed(sz);
+        it->n = n;
+    } else {
+        side.insert(it, Level{key, doubleToFixed(sz), n});
+    }
+
+    updated_ms_ = getTimestampMs();
+}
+
+void OrderBook::clear() {
+    bids_.clear();
+    asks_.clear();
+    time_ = 0;
+    updated_ms_ = 0;
+}
+
+std::optional<double> OrderBook::bestBid() const {
+    if (bids_.empty()) {
+        return std::nullopt;
+    }
+    return fixedToDouble(bids_.back().px);
+}
+
+std::optional<double> OrderBook::bestAsk() const {
+    if (asks_.empty()) {
+        return std::nullopt;
+    }
+    return fixedToDouble(asks_.back().px);
+}
+
+std::optional<double> OrderBook::mid() const {
+    if (bids_.empty() || asks_.empty()) {
+        return std::nullopt;
+    }
+    return fixedToDouble(bids_.back().px + asks_.back().px) / 2.0;
+}
+
+std::vector<BookLevel> OrderBook::depth(bool is_bid, size_t levels) const {
+    const std::vector<Level>& side = is_bid ? bids_ : asks_;
+    size_t count = std::min(levels, side.size());
+
+    std::vector<BookLevel> result;
+    result.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        const Level& level = side[side.size() - 1 - i];
+        result.push_back({fixedToDouble(level.px), fixedToDouble(level.sz), level.n});
+    }
+    return result;
+}
+
+double OrderBook::depthSize(bool is_bid, size_t levels) const {
+    const std::vector<Level>& side = is_bid ? bids_ : asks_;
+    size_t count = std::min(levels, side.size());
+
+    int64_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += side[side.size() - 1 - i].sz;
+    }
+    return fixedToDouble(total);
+}
+
+bool OrderBook::walk(bool is_buy, int64_t sz, double& notional, int64_t& worst_px) const {
+    // Buys consume asks, sells consume bids
+    const std::vector<Level>& side = is_buy ? asks_ : bids_;
+
+    int64_t remaining = sz;
+    notional = 0.0;
+    worst_px = 0;
+    for (auto it = side.rbegin(); it != side.rend() && remaining > 0; ++it) {
+        int64_t take = std::min(remaining, it->sz);
+        notional += fixedToDouble(it->px) * fixedToDouble(take);
+        worst_px = it->px;
+        remaining -= take;
+    }
+    return remaining <= 0;
+}
+
+std::optional<double> OrderBook::vwap(bool is_buy, double sz) const {
+    int64_t target = doubleToFixed(sz);
+    if (target <= 0) {
+        return std::nullopt;
+    }
+
+    double notional = 0.0;
+    int64_t worst_px = 0;
+    if (!walk(is_buy, target, notional, worst_px)) {
+        return std::nullopt;
+    }
+    return notional / fixedToDouble(target);
+}
+
+std::optional<double> OrderBook::fillPrice(bool is_buy, double sz) const {
+    int64_t target = doubleToFixed(sz);
+    if (target <= 0) {
+        return std::nullopt;
+    }
+
+    double notional = 0.0;
+    int64_t worst_px = 0;
+    if (!walk(is_buy, target, notional, worst_px)) {
+        return std::nullopt;
+    }
+    return fixedToDouble(worst_px);
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,351 @@
+#include "hyperliquid/order_manager.hpp"
+#include "hyperliquid/info.hpp"
+#include "hyperliquid/journal.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <cstring>
+
+namespace hyperliquid {
+
+namespace {
+
+double parseDecimal(const nlohmann::json& value) {
+    return fixedToDouble(decimalToFixed(value.get_ref<const std::string&>()));
+}
+
+// Parse an order object from openOrders / orderUpdates
+TrackedOrder parseOrder(const nlohmann::json& order, const Info& info) {
+    TrackedOrder tracked;
+    tracked.oid = order["oid"].get<int64_t>();
+    tracked.coin = order["coin"].get<std::string>();
+    tracked.is_buy = order["side"].get_ref<const std::string&>() == "B";
+    tracked.limit_px = parseDecimal(order["limitPx"]);
+    tracked.sz = parseDecimal(order["sz"]);
+    tracked.orig_sz = order.contains("origSz") ? parseDecimal(order["origSz"]) : tracked.sz;
+    tracked.state = OrderState::Resting;
+    tracked.updated_ms = getTimestampMs();
+
+    auto asset_it = info.coin_to_asset_.find(tracked.coin);
+    tracked.asset = asset_it != info.coin_to_asset_.end() ? asset_it->second : -1;
+
+    if (order.contains("cloid") && order["cloid"].is_string()) {
+        tracked.cloid = Cloid(order["cloid"].get<std::string>());
+    }
+    return tracked;
+}
+
+TrackedOrder fromRequest(const OrderRequest& order, int asset, int64_t oid, const Info& info) {
+    TrackedOrder tracked;
+    tracked.oid = oid;
+    tracked.cloid = order.cloid;
+    tracked.asset = asset;
+    tracked.coin = info.nameToCoin(order.coin);  // wire coin, as in openOrders / orderUpdates
+    tracked.is_buy = order.is_buy;
+    tracked.limit_px = order.limit_px;
+    tracked.sz = order.sz;
+    tracked.orig_sz = order.sz;
+    tracked.state = OrderState::Resting;
+    tracked.updated_ms = getTimestampMs();
+    return tracked;
+}
+
+// Map an orderUpdates status other than open/triggered to a terminal state
+OrderState terminalState(const std::string& status) {
+    if (status == "filled") {
+        return OrderState::Filled;
+    }
+    if (status == "rejected" || status.find("Rejected") != std::string::npos) {
+        return OrderState::Rejected;
+    }
+    return OrderState::Canceled;
+}
+
+// Cancel error for an order that is not open. The exchange appends the asset
+// (" asset=N"), so match on this sentence as a prefix; update it if the
+// exchange rewords the error.
+constexpr const char* ORDER_NOT_OPEN_ERROR = "Order was never placed, already canceled, or filled.";
+
+// A cancel status meaning the order is no longer open: "success" or ORDER_NOT_OPEN_ERROR
+bool orderGone(const OrderStatus& status) {
+    if (const auto* ack = std::get_if<AckStatus>(&status)) {
+        return ack->status == "success";
+    }
+    if (const auto* error = std::get_if<ErrorStatus>(&status)) {
+        return error->message.compare(0, std::strlen(ORDER_NOT_OPEN_ERROR), ORDER_NOT_OPEN_ERROR) == 0;
+    }
+    return false;
+}
+
+// Journal state changes collected under the lock, after releasing it
+void appendChanges(JournalWriter* journal, const std::vector<TrackedOrder>& changes) {
+    if (journal == nullptr) {
+        return;
+    }
+    for (const auto& order : changes) {
+        journal->appendOrder(order);
+    }
+}
+
+} // namespace
+
+void OrderManager::upsertLocked(const TrackedOrder& order, Changes& changes) {
+    std::optional<size_t> slot;
+
+    auto oid_it = by_oid_.find(order.oid);
+    if (oid_it != by_oid_.end()) {
+        slot = oid_it->second;
+    } else if (order.cloid.has_value()) {
+        auto cloid_it = by_cloid_.find(*order.cloid);
+        if (cloid_it != by_cloid_.end()) {
+            slot = cloid_it->second;
+        }
+    }
+
+    if (slot.has_value()) {
+        // Drop stale index entries before overwriting the slot
+        TrackedOrder& existing = orders_[*slot];
+        by_oid_.erase(existing.oid);
+        if (existing.cloid.has_value()) {
+            by_cloid_.erase(*existing.cloid);
+        }
+        existing = order;
+    } else {
+        slot = orders_.size();
+        orders_.push_back(order);
+    }
+
+    by_oid_[order.oid] = *slot;
+    if (order.cloid.has_value()) {
+        by_cloid_[*order.cloid] = *slot;
+    }
+
+    if (journal_) {
+        changes.push_back(order);
+    }
+}
+
+void OrderManager::removeLocked(size_t slot, OrderState state, Changes& changes) {
+    TrackedOrder& removed = orders_[slot];
+    if (journal_) {
+        changes.push_back(removed);
+        changes.back().state = state;
+        changes.back().updated_ms = getTimestampMs();
+    }
+
+    by_oid_.erase(removed.oid);
+    if (removed.cloid.has_value()) {
+        by_cloid_.erase(*removed.cloid);
+    }
+
+    // Swap-remove to keep the array dense
+    size_t last = orders_.size() - 1;
+    if (slot != last) {
+        orders_[slot] = std::move(orders_[last]);
+        by_oid_[orders_[slot].oid] = slot;
+        if (orders_[slot].cloid.has_value()) {
+            by_cloid_[*orders_[slot].cloid] = slot;
+        }
+    }
+    orders_.pop_back();
+}
+
+std::optional<size_t> OrderManager::slotLocked(const OidOrCloid& target) const {
+    if (std::holds_alternative<int64_t>(target)) {
+        auto it = by_oid_.find(std::get<int64_t>(target));
+        if (it != by_oid_.end()) {
+            return it->second;
+        }
+    } else {
+        auto it = by_cloid_.find(std::get<Cloid>(target));
+        if (it != by_cloid_.end()) {
+            return it->second;
+        }
+    }
+    return std::nullopt;
+}
+
+void OrderManager::onOrderResponse(const std::vector<OrderRequest>& orders,
+                                   const std::vector<int>& assets,
+                                   const ActionResponse& response,
+                                   const Info& info) {
+    if (!response.ok) {
+        return;
+    }
+
+    Changes changes;
+    std::shared_ptr<JournalWriter> journal;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        journal = journal_;
+        for (size_t i = 0; i < response.statuses.size() && i < orders.size(); ++i) {
+            const OrderStatus& status = response.statuses[i];
+
+            if (const auto* resting = std::get_if<RestingStatus>(&status)) {
+                upsertLocked(fromRequest(orders[i], assets[i], resting->oid, info), changes);
+            } else if (std::holds_alternative<FilledStatus>(status) && orders[i].cloid.has_value()) {
+                // Filled on arrival: make sure nothing stale is left under this cloid
+                auto slot = slotLocked(*orders[i].cloid);
+                if (slot.has_value()) {
+                    removeLocked(*slot, OrderState::Filled, changes);
+                }
+            }
+        }
+    }
+    appendChanges(journal.get(), changes);
+}
+
+void OrderManager::onCancelResponse(const std::vector<OidOrCloid>& targets,
+                                    const ActionResponse& response) {
+    if (!response.ok) {
+        return;
+    }
+
+    Changes changes;
+    std::shared_ptr<JournalWriter> journal;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        journal = journal_;
+        for (size_t i = 0; i < response.statuses.size() && i < targets.size(); ++i) {
+            if (!orderGone(response.statuses[i])) {
+                continue;  // Still live on the exchange (e.g. rate limited); keep tracking it
+            }
+            auto slot = slotLocked(targets[i]);
+            if (slot.has_value()) {
+                removeLocked(*slot, OrderState::Canceled, changes);
+            }
+        }
+    }
+    appendChanges(journal.get(), changes);
+}
+
+void OrderManager::onModifyResponse(const std::vector<ModifyRequest>& modifies,
+                                    const std::vector<int>& assets,
+                                    const ActionResponse& response,
+                                    const Info& info) {
+    if (!response.ok) {
+        return;
+    }
+
+    Changes changes;
+    std::shared_ptr<JournalWriter> journal;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        journal = journal_;
+        for (size_t i = 0; i < response.statuses.size() && i < modifies.size(); ++i) {
+            const OrderStatus& status = response.statuses[i];
+            if (std::holds_alternative<ErrorStatus>(status)) {
+                continue;  // Original order is unchanged
+            }
+
+            // A successful modify replaces the original order
+            auto slot = slotLocked(modifies[i].oid);
+            if (slot.has_value()) {
+                removeLocked(*slot, OrderState::Canceled, changes);
+            }
+
+            if (const auto* resting = std::get_if<RestingStatus>(&status)) {
+                OrderRequest order = modifies[i].order;
+                if (!order.cloid.has_value() && std::holds_alternative<Cloid>(modifies[i].oid)) {
+                    order.cloid = std::get<Cloid>(modifies[i].oid);
+                }
+                upsertLocked(fromRequest(order, assets[i], resting->oid, info), changes);
+            }
+        }
+    }
+    appendChanges(journal.get(), changes);
+}
+
+void OrderManager::applyOrderUpdates(const nlohmann::json& msg, const Info& info) {
+    const nlohmann::json& updates = msg.contains("data") ? msg["data"] : msg;
+
+    Changes changes;
+    std::shared_ptr<JournalWriter> journal;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        journal = journal_;
+        for (const auto& update : updates) {
+            const std::string& status = update["status"].get_ref<const std::string&>();
+            TrackedOrder order = parseOrder(update["order"], info);
+
+            if (status == "open" || status == "triggered") {
+                upsertLocked(order, changes);
+            } else {
+                // filled, canceled, rejected, marginCanceled, ...
+                auto slot = slotLocked(order.oid);
+                if (slot.has_value()) {
+                    removeLocked(*slot, terminalState(status), changes);
+                }
+            }
+        }
+    }
+    appendChanges(journal.get(), changes);
+}
+
+void OrderManager::seed(const nlohmann::json& open_orders, const Info& info) {
+    Changes changes;
+    std::shared_ptr<JournalWriter> journal;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        journal = journal_;
+        orders_.clear();
+        by_oid_.clear();
+        by_cloid_.clear();
+
+        for (const auto& order : open_orders) {
+            upsertLocked(parseOrder(order, info), changes);
+        }
+    }
+    appendChanges(journal.get(), changes);
+}
+
+std::optional<TrackedOrder> OrderManager::findByOid(int64_t oid) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto slot = slotLocked(oid);
+    if (!slot.has_value()) {
+        return std::nullopt;
+    }
+    return orders_[*slot];
+}
+
+std::optional<TrackedOrder> OrderManager::findByCloid(const Cloid& cloid) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto slot = slotLocked(cloid);
+    if (!slot.has_value()) {
+        return std::nullopt;
+    }
+    return orders_[*slot];
+}
+
+std::vector<TrackedOrder> OrderManager::openOrders() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return orders_;
+}
+
+std::vector<TrackedOrder> OrderManager::openOrders(int asset) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TrackedOrder> result;
+    for (const auto& order : orders_) {
+        if (order.asset == asset) {
+            result.push_back(order);
+        }
+    }
+    return result;
+}
+
+size_t OrderManager::openCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return orders_.size();
+}
+
+void OrderManager::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    orders_.clear();
+    by_oid_.clear();
+    by_cloid_.clear();
+}
+
+void OrderManager::setJournal(std::shared_ptr<JournalWriter> journal) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    journal_ = std::move(journal);
+}
+
+} // namespace hyperliquid
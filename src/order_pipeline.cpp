@@ -0,0 +1,120 @@
+#include "hyperliquid/order_pipeline.hpp"
+#include <stdexcept>
+
+namespace hyperliquid {
+
+OrderPipeline::OrderPipeline(Exchange& exchange, size_t depth)
+    : exchange_(exchange), signed_(depth == 0 ? 1 : depth) {
+    sender_ = std::thread(&OrderPipeline::runSender, this);
+    signer_ = std::thread(&OrderPipeline::runSigner, this);
+}
+
+OrderPipeline::~OrderPipeline() {
+    {
+        std::lock_guard<std::mutex> lock(intake_mutex_);
+        stopping_ = true;
+    }
+    intake_cv_.notify_all();
+    if (signer_.joinable()) {
+        signer_.join();
+    }
+    if (sender_.joinable()) {
+        sender_.join();
+    }
+}
+
+std::future<nlohmann::json> OrderPipeline::submit(const std::vector<OrderRequest>& orders,
+                                                  const std::optional<BuilderInfo>& builder,
+                                                  const std::string& grouping) {
+    Job job;
+    job.orders = orders;
+    job.builder = builder;
+    job.grouping = grouping;
+    auto future = job.promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(intake_mutex_);
+        if (stopping_) {
+            throw std::runtime_error("OrderPipeline is stopping");
+        }
+        intake_.push_back(std::move(job));
+    }
+    intake_cv_.notify_one();
+    return future;
+}
+
+std::future<nlohmann::json> OrderPipeline::submit(const OrderRequest& order,
+                                                  const std::optional<BuilderInfo>& builder) {
+    return submit(std::vector<OrderRequest>{order}, builder);
+}
+
+void OrderPipeline::handOff(Signed&& item) {
+    // Backpressure: the sender is at most `depth` actions behind
+    while (!signed_.tryPush(std::move(item))) {
+        std::unique_lock<std::mutex> lock(space_mutex_);
+        space_cv_.wait(lock, [this] { return !signed_.full(); });
+    }
+    {
+        // Empty critical section orders the push before the sender's wait check
+        std::lock_guard<std::mutex> lock(sender_mutex_);
+    }
+    sender_cv_.notify_one();
+}
+
+void OrderPipeline::runSigner() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(intake_mutex_);
+            intake_cv_.wait(lock, [this] { return stopping_ || !intake_.empty(); });
+            if (intake_.empty()) {
+                break;
+            }
+            job = std::move(intake_.front());
+            intake_.pop_front();
+        }
+
+        Signed item;
+        item.promise = std::move(job.promise);
+        try {
+            item.prepared = exchange_.prepareOrders(job.orders, job.builder, job.grouping);
+        } catch (...) {
+            item.promise.set_exception(std::current_exception());
+        }
+        handOff(std::move(item));
+    }
+
+    Signed last;
+    last.last = true;
+    handOff(std::move(last));
+}
+
+void OrderPipeline::runSender() {
+    Signed item;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(sender_mutex_);
+            sender_cv_.wait(lock, [this] { return !signed_.empty(); });
+        }
+        while (signed_.tryPop(item)) {
+            {
+                // Same ordering trick as handOff(), for the signer's full-queue wait
+                std::lock_guard<std::mutex> lock(space_mutex_);
+            }
+            space_cv_.notify_one();
+
+            if (item.last) {
+                return;
+            }
+            if (!item.prepared) {
+                continue;  // signing failed, promise already holds the error
+            }
+            try {
+                item.promise.set_value(exchange_.sendOrders(*item.prepared));
+            } catch (...) {
+                item.promise.set_exception(std::current_exception());
+            }
+        }
+    }
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,177 @@
+#include "hyperliquid/positions.hpp"
+#include "hyperliquid/info.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <cmath>
+
+namespace hyperliquid {
+
+namespace {
+
+double parseDecimal(const nlohmann::json& value) {
+    return fixedToDouble(decimalToFixed(value.get_ref<const std::string&>()));
+}
+
+} // namespace
+
+void PositionTracker::seed(const nlohmann::json& user_state, const Info& info) {
+    int64_t now = getTimestampMs();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    positions_.clear();
+
+    for (const auto& asset_pos : user_state["assetPositions"]) {
+        const auto& pos = asset_pos["position"];
+        const std::string& coin = pos["coin"].get_ref<const std::string&>();
+
+        auto asset_it = info.coin_to_asset_.find(coin);
+        if (asset_it == info.coin_to_asset_.end()) {
+            continue;
+        }
+
+        Position position;
+        position.asset = asset_it->second;
+        position.coin = coin;
+        position.szi = parseDecimal(pos["szi"]);
+        position.entry_px = pos.contains("entryPx") && pos["entryPx"].is_string() ?
+            parseDecimal(pos["entryPx"]) : 0.0;
+        position.updated_ms = now;
+        positions_[position.asset] = position;
+    }
+
+    seeded_ = true;
+}
+
+void PositionTracker::applyFills(const nlohmann::json& msg, const Info& info) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fed_by_fills_ = true;
+
+    const nlohmann::json& data = msg.contains("data") ? msg["data"] : msg;
+    if (data.is_object() && data.value("isSnapshot", false)) {
+        return;
+    }
+
+    const nlohmann::json* fills = &data;
+    if (!data.is_array()) {
+        // userEvents also carries funding, liquidation and nonUserCancel events
+        auto it = data.find("fills");
+        if (it == data.end() || !it->is_array()) {
+            return;
+        }
+        fills = &*it;
+    }
+
+    for (const auto& fill : *fills) {
+        const std::string& coin = fill["coin"].get_ref<const std::string&>();
+
+        auto asset_it = info.coin_to_asset_.find(coin);
+        if (asset_it == info.coin_to_asset_.end() || asset_it->second >= 10000) {
+            continue;  // Spot fills change balances, not positions
+        }
+
+        bool is_buy = fill["side"].get_ref<const std::string&>() == "B";
+        applyFillLocked(asset_it->second, coin, is_buy,
+                        parseDecimal(fill["sz"]), parseDecimal(fill["px"]));
+    }
+}
+
+void PositionTracker::applyFill(int asset, const std::string& coin, bool is_buy, double sz, double px) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fed_by_fills_ = true;
+    applyFillLocked(asset, coin, is_buy, sz, px);
+}
+
+void PositionTracker::applyFillLocked(int asset, const std::string& coin, bool is_buy, double sz, double px) {
+    auto it = positions_.find(asset);
+    if (it == positions_.end()) {
+        it = positions_.emplace(asset, Position{asset, coin, 0.0, 0.0, 0}).first;
+    }
+
+    Position& pos = it->second;
+    double delta = is_buy ? sz : -sz;
+    double new_szi = pos.szi + delta;
+
+    if (pos.szi == 0.0 || (pos.szi > 0) == (delta > 0)) {
+        // Opening or increasing: blend entry price
+        double total = std::abs(pos.szi) + sz;
+        pos.entry_px = (pos.entry_px * std::abs(pos.szi) + px * sz) / total;
+    } else if (std::abs(new_szi) > 1e-12 && (new_szi > 0) != (pos.szi > 0)) {
+        // Flipped through zero: remainder opened at fill price
+        pos.entry_px = px;
+    }
+
+    pos.szi = std::abs(new_szi) < 1e-12 ? 0.0 : new_szi;
+    if (pos.szi == 0.0) {
+        pos.entry_px = 0.0;
+    }
+    pos.updated_ms = getTimestampMs();
+}
+
+void PositionTracker::applyOrderResponse(const ActionResponse& response,
+                                         const std::vector<int>& assets,
+                                         const std::vector<bool>& is_buy,
+                                         const std::vector<std::string>& coins) {
+    if (!response.ok) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < response.statuses.size() && i < assets.size(); ++i) {
+        const auto* filled = std::get_if<FilledStatus>(&response.statuses[i]);
+        if (!filled || assets[i] >= 10000) {
+            continue;
+        }
+
+        applyFillLocked(assets[i], coins[i], is_buy[i],
+                        fixedToDouble(filled->total_sz), fixedToDouble(filled->avg_px));
+    }
+}
+
+std::optional<Position> PositionTracker::position(int asset) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = positions_.find(asset);
+    if (it == positions_.end() || it->second.szi == 0.0) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::vector<Position> PositionTracker::positions() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Position> result;
+    result.reserve(positions_.size());
+    for (const auto& [asset, pos] : positions_) {
+        if (pos.szi != 0.0) {
+            result.push_back(pos);
+        }
+    }
+    return result;
+}
+
+bool PositionTracker::isSeeded() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return seeded_;
+}
+
+bool PositionTracker::isFed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return seeded_ && (fed_by_fills_ || track_order_acks_);
+}
+
+void PositionTracker::setTrackOrderAcks(bool enabled) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    track_order_acks_ = enabled;
+}
+
+bool PositionTracker::tracksOrderAcks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return track_order_acks_;
+}
+
+void PositionTracker::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    positions_.clear();
+    seeded_ = false;
+    fed_by_fills_ = false;
+}
+
+} // namespace hyperliquid
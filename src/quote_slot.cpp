@@ -0,0 +1,103 @@
+#include "hyperliquid/quote_slot.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/signing.hpp"
+#include <stdexcept>
+
+namespace hyperliquid {
+
+namespace {
+
+// Placeholder values located in the encoded template, then cut out
+const std::string PRICE_MARKER = "\x01quote-slot-px\x01";
+const std::string SIZE_MARKER = "\x01quote-slot-sz\x01";
+
+} // namespace
+
+QuoteSlot::QuoteSlot(int asset,
+                     const std::string& coin,
+                     bool is_buy,
+                     const std::string& tif,
+                     const Cloid& cloid,
+                     int sz_decimals,
+                     bool reduce_only)
+    : asset_(asset),
+      coin_(coin),
+      is_buy_(is_buy),
+      tif_(tif),
+      cloid_(cloid),
+      sz_decimals_(sz_decimals),
+      is_spot_(asset >= 10000),
+      reduce_only_(reduce_only) {
+    // Build the batchModify action exactly as Exchange::bulkModifyOrders does
+    OrderRequest order;
+    order.coin = coin_;
+    order.is_buy = is_buy_;
+    order.sz = 0.0;
+    order.limit_px = 0.0;
+    order.order_type.limit = LimitOrderType{tif_};
+    order.reduce_only = reduce_only_;
+    order.cloid = cloid_;
+
+    OrderWire wire = orderRequestToOrderWire(order, asset_);
+    wire.price = PRICE_MARKER;
+    wire.size = SIZE_MARKER;
+
+    nlohmann::ordered_json modify_wire;
+    modify_wire["oid"] = cloid_.toRaw();
+    modify_wire["order"] = wire.toJson();
+
+    action_["type"] = "batchModify";
+    action_["modifies"] = nlohmann::ordered_json::array({modify_wire});
+
+    // Split the encoded template around the two placeholder strings
+    std::string packed = packAction(action_);
+    std::string price_encoded;
+    std::string size_encoded;
+    appendMsgpackString(price_encoded, PRICE_MARKER);
+    appendMsgpackString(size_encoded, SIZE_MARKER);
+
+    size_t price_pos = packed.find(price_encoded);
+    size_t size_pos = packed.find(size_encoded);
+    if (price_pos == std::string::npos || size_pos == std::string::npos || size_pos < price_pos) {
+        throw std::runtime_error("Failed to build quote slot template");
+    }
+
+    prefix_ = packed.substr(0, price_pos);
+    middle_ = packed.substr(price_pos + price_encoded.size(),
+                            size_pos - price_pos - price_encoded.size());
+    suffix_ = packed.substr(size_pos + size_encoded.size());
+}
+
+void QuoteSlot::update(double px, double sz) {
+    px_ = roundPrice(px, sz_decimals_, is_spot_);
+    sz_ = roundSize(sz, sz_decimals_);
+
+    std::string price_wire = floatToWire(px_);
+    std::string size_wire = floatToWire(sz_);
+
+    packed_.clear();
+    packed_.append(prefix_);
+    appendMsgpackString(packed_, price_wire);
+    packed_.append(middle_);
+    appendMsgpackString(packed_, size_wire);
+    packed_.append(suffix_);
+
+    auto& order = action_["modifies"][0]["order"];
+    order["p"] = std::move(price_wire);
+    order["s"] = std::move(size_wire);
+}
+
+ModifyRequest QuoteSlot::modifyRequest() const {
+    ModifyRequest modify;
+    modify.oid = cloid_;
+    modify.order.coin = coin_;
+    modify.order.is_buy = is_buy_;
+    modify.order.sz = sz_;
+    modify.order.limit_px = px_;
+    modify.order.order_type.limit = LimitOrderType{tif_};
+    modify.order.reduce_only = reduce_only_;
+    modify.order.cloid = cloid_;
+    return modify;
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,158 @@
+#include "hyperliquid/rate_limiter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace hyperliquid {
+
+namespace {
+
+constexpr size_t EXCHANGE_BATCH_STEP = 40;
+constexpr double LIGHT_INFO_WEIGHT = 2.0;
+constexpr double USER_ROLE_WEIGHT = 60.0;
+constexpr double DEFAULT_INFO_WEIGHT = 20.0;
+
+const std::unordered_set<std::string> LIGHT_INFO_TYPES = {
+    "l2Book",
+    "allMids",
+    "clearinghouseState",
+    "orderStatus",
+    "spotClearinghouseState",
+    "exchangeStatus",
+};
+
+} // namespace
+
+RateLimiter::RateLimiter(const RateLimitConfig& config)
+    : config_(config),
+      tokens_(config.burst),
+      last_refill_(Clock::now()),
+      blocked_until_(Clock::now()) {
+    if (config_.burst <= 0.0 || config_.weight_per_minute <= config_.burst) {
+        throw std::invalid_argument("RateLimiter needs 0 < burst < weight_per_minute");
+    }
+    if (config_.priority_reserve < 0.0 || config_.priority_reserve >= config_.burst) {
+        throw std::invalid_argument("RateLimiter priority_reserve must be below burst");
+    }
+    refill_per_ms_ = (config_.weight_per_minute - config_.burst) / 60000.0;
+}
+
+void RateLimiter::refillLocked(Clock::time_point now) {
+    double elapsed_ms = std::chrono::duration<double, std::milli>(now - last_refill_).count();
+    if (elapsed_ms > 0.0) {
+        tokens_ = std::min(config_.burst, tokens_ + elapsed_ms * refill_per_ms_);
+        last_refill_ = now;
+    }
+}
+
+bool RateLimiter::trySpendLocked(double weight, RateLane lane, Clock::time_point now) {
+    if (now < blocked_until_) {
+        return false;
+    }
+    refillLocked(now);
+
+    // Normal requests leave the reserve for cancels
+    double floor = lane == RateLane::Priority ? 0.0 : config_.priority_reserve;
+    double cost = std::min(weight, config_.burst - floor);
+    if (tokens_ - cost < floor) {
+        return false;
+    }
+    tokens_ -= cost;
+    return true;
+}
+
+void RateLimiter::acquire(double weight, RateLane lane) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (lane == RateLane::Priority) {
+        ++priority_waiting_;
+    }
+
+    while (true) {
+        auto now = Clock::now();
+        bool yield_to_priority = lane == RateLane::Normal && priority_waiting_ > 0;
+        if (!yield_to_priority && trySpendLocked(weight, lane, now)) {
+            break;
+        }
+
+        // Sleep until the backoff ends or enough weight has refilled
+        auto wake = now + std::chrono::milliseconds(1);
+        if (now < blocked_until_) {
+            wake = blocked_until_;
+        } else if (!yield_to_priority) {
+            double floor = lane == RateLane::Priority ? 0.0 : config_.priority_reserve;
+            double missing = std::min(weight, config_.burst - floor) - (tokens_ - floor);
+            wake = now + std::chrono::microseconds(
+                static_cast<int64_t>(std::ceil(missing / refill_per_ms_ * 1000.0)));
+        }
+        cv_.wait_until(lock, wake);
+    }
+
+    if (lane == RateLane::Priority) {
+        --priority_waiting_;
+        cv_.notify_all();
+    }
+}
+
+bool RateLimiter::tryAcquire(double weight, RateLane lane) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (lane == RateLane::Normal && priority_waiting_ > 0) {
+        return false;
+    }
+    return trySpendLocked(weight, lane, Clock::now());
+}
+
+void RateLimiter::onRateLimited(std::chrono::milliseconds retry_after) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (retry_after.count() > 0) {
+        backoff_ = std::min(retry_after, config_.max_backoff);
+    } else if (backoff_.count() == 0) {
+        backoff_ = config_.min_backoff;
+    } else {
+        backoff_ = std::min(backoff_ * 2, config_.max_backoff);
+    }
+
+    auto now = Clock::now();
+    blocked_until_ = std::max(blocked_until_, now + backoff_);
+    tokens_ = 0.0;
+    last_refill_ = blocked_until_;
+}
+
+void RateLimiter::onSuccess() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    backoff_ = std::chrono::milliseconds(0);
+}
+
+double RateLimiter::available() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    if (now < blocked_until_) {
+        return 0.0;
+    }
+    refillLocked(now);
+    return tokens_;
+}
+
+double RateLimiter::requestWeight(const std::string& url_path,
+                                  const std::string& type,
+                                  size_t batch_length) {
+    if (url_path == "/exchange") {
+        return 1.0 + static_cast<double>(batch_length / EXCHANGE_BATCH_STEP);
+    }
+    if (LIGHT_INFO_TYPES.count(type) != 0) {
+        return LIGHT_INFO_WEIGHT;
+    }
+    if (type == "userRole") {
+        return USER_ROLE_WEIGHT;
+    }
+    return DEFAULT_INFO_WEIGHT;
+}
+
+RateLane RateLimiter::laneFor(const std::string& type) {
+    if (type == "cancel" || type == "cancelByCloid" || type == "scheduleCancel") {
+        return RateLane::Priority;
+    }
+    return RateLane::Normal;
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,88 @@
+#include "hyperliquid/transfer_stats.hpp"
+
+namespace hyperliquid {
+
+namespace {
+
+constexpr int64_t NS_PER_US = 1000;
+
+} // namespace
+
+TransferSummary& TransferStats::summaryLocked(const std::string& endpoint, const std::string& type) {
+    auto key = std::make_pair(endpoint, type);
+    auto it = summaries_.find(key);
+    if (it == summaries_.end()) {
+        it = summaries_.emplace(key, TransferSummary()).first;
+        it->second.endpoint = endpoint;
+        it->second.type = type;
+    }
+    return it->second;
+}
+
+void TransferStats::record(const TransferTiming& timing) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TransferSummary& summary = summaryLocked(timing.endpoint, timing.type);
+
+    ++summary.count;
+    if (timing.reused_connection) {
+        ++summary.reused;
+    }
+    summary.bytes_sent += timing.bytes_sent;
+    summary.bytes_received += timing.bytes_received;
+
+    summary.dns.record(timing.dns_us * NS_PER_US);
+    summary.connect.record(timing.connect_us * NS_PER_US);
+    summary.tls.record(timing.tls_us * NS_PER_US);
+    summary.server.record(timing.server_us * NS_PER_US);
+    summary.ttfb.record(timing.ttfb_us * NS_PER_US);
+    summary.total.record(timing.total_us * NS_PER_US);
+}
+
+void TransferStats::recordError(const std::string& endpoint, const std::string& type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++summaryLocked(endpoint, type).errors;
+}
+
+void TransferStats::recordRetry(const std::string& endpoint, const std::string& type) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++summaryLocked(endpoint, type).retries;
+}
+
+void TransferStats::recordHedge(const std::string& endpoint, const std::string& type, bool won) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TransferSummary& summary = summaryLocked(endpoint, type);
+    ++summary.hedges;
+    if (won) {
+        ++summary.hedge_wins;
+    }
+}
+
+int64_t TransferStats::totalPercentile(const std::string& endpoint,
+                                       const std::string& type,
+                                       double q,
+                                       uint64_t min_count) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = summaries_.find(std::make_pair(endpoint, type));
+    if (it == summaries_.end() || it->second.total.count() < min_count ||
+        it->second.total.count() == 0) {
+        return -1;
+    }
+    return it->second.total.percentile(q);
+}
+
+std::vector<TransferSummary> TransferStats::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<TransferSummary> result;
+    result.reserve(summaries_.size());
+    for (const auto& entry : summaries_) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+void TransferStats::reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    summaries_.clear();
+}
+
+} // namespace hyperliquid
@@ -1,47 +1,83 @@
 #include "hyperliquid/types.hpp"
 #include "hyperliquid/utils/conversions.hpp"
+#include <random>
 #include <stdexcept>
-#include <sstream>
-#include <iomanip>
 
 namespace hyperliquid {
 
 // Cloid implementation
 
-Cloid::Cloid(const std::string& raw) : raw_cloid_(raw) {
-    validate();
-}
+namespace {
 
-Cloid Cloid::fromInt(uint64_t value) {
-    std::ostringstream oss;
-    oss << "0x" << std::setfill('0') << std::setw(32) << std::hex << value;
-    return Cloid(oss.str());
-}
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
 
-Cloid Cloid::fromStr(const std::string& hex) {
-    std::string normalized = hex;
-    if (hex.substr(0, 2) != "0x") {
-        normalized = "0x" + hex;
-    }
-    return Cloid(normalized);
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
 }
 
-void Cloid::validate() {
-    if (raw_cloid_.length() != 34) {
+} // namespace
+
+Cloid::Cloid(const std::string& raw) : hi_(0), lo_(0) {
+    if (raw.length() != RAW_LENGTH) {
         throw std::invalid_argument("Cloid must be 34 characters (0x + 32 hex chars)");
     }
-    if (raw_cloid_.substr(0, 2) != "0x") {
+    if (raw[0] != '0' || raw[1] != 'x') {
         throw std::invalid_argument("Cloid must start with 0x");
     }
-    // Validate hex characters
-    for (size_t i = 2; i < raw_cloid_.length(); ++i) {
-        char c = raw_cloid_[i];
-        if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'))) {
+    for (size_t i = 2; i < RAW_LENGTH; ++i) {
+        int value = hexValue(raw[i]);
+        if (value < 0) {
             throw std::invalid_argument("Cloid contains invalid hex characters");
         }
+        uint64_t& half = i < 18 ? hi_ : lo_;
+        half = (half << 4) | static_cast<uint64_t>(value);
     }
 }
 
+Cloid Cloid::fromInt(uint64_t value) {
+    return Cloid(0, value);
+}
+
+Cloid Cloid::fromStr(const std::string& hex) {
+    if (hex.compare(0, 2, "0x") != 0) {
+        return Cloid("0x" + hex);
+    }
+    return Cloid(hex);
+}
+
+void Cloid::toRaw(char* out) const {
+    out[0] = '0';
+    out[1] = 'x';
+    for (int i = 0; i < 16; ++i) {
+        out[2 + i] = HEX_DIGITS[(hi_ >> (60 - 4 * i)) & 0xF];
+        out[18 + i] = HEX_DIGITS[(lo_ >> (60 - 4 * i)) & 0xF];
+    }
+}
+
+std::string Cloid::toRaw() const {
+    std::string raw(RAW_LENGTH, '\0');
+    toRaw(&raw[0]);
+    return raw;
+}
+
+// CloidGenerator implementation
+
+CloidGenerator::CloidGenerator() : counter_(0) {
+    // Start time keeps prefixes increasing across restarts; random bits
+    // separate processes started in the same millisecond
+    std::random_device rd;
+    uint64_t now_ms = static_cast<uint64_t>(getTimestampMs());
+    prefix_ = (now_ms << 20) | (static_cast<uint64_t>(rd()) & 0xFFFFF);
+}
+
+CloidGenerator& CloidGenerator::global() {
+    static CloidGenerator generator;
+    return generator;
+}
+
 // OrderType implementation
 
 nlohmann::json OrderType::toJson() const {
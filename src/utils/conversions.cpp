@@ -1,9 +1,11 @@
 #include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
 #include <algorithm>
 #include <chrono>
+#include <limits>
 #include <stdexcept>
 
 namespace hyperliquid {
@@ -114,6 +116,8 @@ int64_t getTimestampMs() {
 }
 
 double roundPrice(double price, int sz_decimals, bool is_spot) {
+    HYPERLIQUID_LATENCY_SCOPE(Rounding);
+
     // Integer prices > 100k are always allowed
     if (price > 100000.0 && price == std::floor(price)) {
         return price;
@@ -143,9 +147,89 @@ double roundPrice(double price, int sz_decimals, bool is_spot) {
 }
 
 double roundSize(double size, int sz_decimals) {
+    HYPERLIQUID_LATENCY_SCOPE(Rounding);
+
     // Round size to szDecimals
     double multiplier = std::pow(10.0, sz_decimals);
     return std::round(size * multiplier) / multiplier;
 }
 
+namespace {
+
+// Largest integer part representable in fixed point (about 9.2e10)
+constexpr int64_t MAX_FIXED_INTEGER = std::numeric_limits<int64_t>::max() / FIXED_POINT_SCALE;
+
+} // namespace
+
+int64_t decimalToFixed(std::string_view value) {
+    size_t i = 0;
+    bool negative = false;
+    if (i < value.size() && (value[i] == '-' || value[i] == '+')) {
+        negative = value[i] == '-';
+        ++i;
+    }
+
+    int64_t integer_part = 0;
+    int64_t fraction_part = 0;
+    int fraction_digits = 0;
+    bool seen_digit = false;
+    bool seen_point = false;
+
+    for (; i < value.size(); ++i) {
+        char c = value[i];
+        if (c == '.' && !seen_point) {
+            seen_point = true;
+        } else if (c >= '0' && c <= '9') {
+            seen_digit = true;
+            if (!seen_point) {
+                if (integer_part > MAX_FIXED_INTEGER) {
+                    throw std::out_of_range("Decimal out of fixed-point range: " + std::string(value));
+                }
+                integer_part = integer_part * 10 + (c - '0');
+            } else if (fraction_digits < 8) {
+                fraction_part = fraction_part * 10 + (c - '0');
+                ++fraction_digits;
+            }
+        } else {
+            throw std::invalid_argument("Invalid decimal string: " + std::string(value));
+        }
+    }
+
+    if (!seen_digit) {
+        throw std::invalid_argument("Invalid decimal string: " + std::string(value));
+    }
+
+    // Scale fraction up to 8 digits
+    for (; fraction_digits < 8; ++fraction_digits) {
+        fraction_part *= 10;
+    }
+
+    if (integer_part > (std::numeric_limits<int64_t>::max() - fraction_part) / FIXED_POINT_SCALE) {
+        throw std::out_of_range("Decimal out of fixed-point range: " + std::string(value));
+    }
+
+    int64_t result = integer_part * FIXED_POINT_SCALE + fraction_part;
+    return negative ? -result : result;
+}
+
+int64_t doubleToFixed(double value) {
+    double scaled = value * static_cast<double>(FIXED_POINT_SCALE);
+    // 2^63 is exactly representable; anything at or beyond it does not fit
+    if (!(std::abs(scaled) < 9223372036854775808.0)) {
+        throw std::out_of_range("Value out of fixed-point range: " + std::to_string(value));
+    }
+    return static_cast<int64_t>(std::llround(scaled));
+}
+
+int64_t integerToFixed(int64_t value) {
+    if (value > MAX_FIXED_INTEGER || value < -MAX_FIXED_INTEGER) {
+        throw std::out_of_range("Integer out of fixed-point range: " + std::to_string(value));
+    }
+    return value * FIXED_POINT_SCALE;
+}
+
+double fixedToDouble(int64_t value) {
+    return static_cast<double>(value) / static_cast<double>(FIXED_POINT_SCALE);
+}
+
 } // namespace hyperliquid
@@ -1,5 +1,6 @@
 #include "hyperliquid/types.hpp"
 #include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <openssl/ec.h>
 #include <openssl/obj_mac.h>
 #include <openssl/ecdsa.h>
@@ -318,6 +319,8 @@ int calculateRecoveryId(const EC_KEY* ec_key,
 }
 
 Signature signHash(const void* ec_key_ptr, const std::vector<uint8_t>& hash) {
+    HYPERLIQUID_LATENCY_SCOPE(Ecdsa);
+
     EC_KEY* ec_key = static_cast<EC_KEY*>(const_cast<void*>(ec_key_ptr));
 
     if (hash.size() != 32) {
@@ -1,5 +1,6 @@
 #include "hyperliquid/types.hpp"
 #include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <nlohmann/json.hpp>
 #include <vector>
 #include <string>
@@ -107,6 +108,8 @@ std::vector<uint8_t> hashStruct(const std::string& struct_type,
 }
 
 std::vector<uint8_t> encodeTypedData(const nlohmann::json& typed_data) {
+    HYPERLIQUID_LATENCY_SCOPE(Eip712);
+
     // EIP-712 prefix
     std::vector<uint8_t> result = {0x19, 0x01};
 
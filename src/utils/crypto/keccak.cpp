@@ -1,4 +1,5 @@
 #include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <openssl/evp.h>
 #include <stdexcept>
 #include <vector>
@@ -7,6 +8,8 @@ namespace hyperliquid {
 namespace crypto {
 
 std::vector<uint8_t> keccak256(const uint8_t* data, size_t len) {
+    HYPERLIQUID_LATENCY_SCOPE(Keccak);
+
     std::vector<uint8_t> hash(32);
 
     // OpenSSL 3.0+ uses EVP interface for Keccak
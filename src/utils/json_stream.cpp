@@ -0,0 +1,72 @@
+#include "hyperliquid/utils/json_stream.hpp"
+#include <stdexcept>
+
+namespace hyperliquid {
+
+ObjectArrayStream::ObjectArrayStream(ObjectCallback on_object)
+    : on_object_(std::move(on_object)) {}
+
+void ObjectArrayStream::feed(const char* data, size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        char c = data[i];
+        bool whitespace = (c == ' ' || c == '\n' || c == '\r' || c == '\t');
+
+        if (depth_ == 0) {
+            if (whitespace) {
+                continue;
+            }
+            if (started_ || c != '[') {
+                throw std::runtime_error("Expected a JSON array in response");
+            }
+            started_ = true;
+            depth_ = 1;
+            continue;
+        }
+
+        if (depth_ == 1) {
+            if (whitespace || c == ',') {
+                continue;
+            }
+            if (c == ']') {
+                depth_ = 0;
+                done_ = true;
+                continue;
+            }
+            if (c != '{') {
+                throw std::runtime_error("Unexpected non-object element in response array");
+            }
+            object_.assign(1, c);
+            depth_ = 2;
+            continue;
+        }
+
+        // Inside an element: buffer bytes, track nesting outside strings
+        object_.push_back(c);
+        if (in_string_) {
+            if (escaped_) {
+                escaped_ = false;
+            } else if (c == '\\') {
+                escaped_ = true;
+            } else if (c == '"') {
+                in_string_ = false;
+            }
+        } else if (c == '"') {
+            in_string_ = true;
+        } else if (c == '{' || c == '[') {
+            ++depth_;
+        } else if (c == '}' || c == ']') {
+            if (--depth_ == 1) {
+                ++count_;
+                on_object_(object_);
+            }
+        }
+    }
+}
+
+void ObjectArrayStream::finish() {
+    if (!done_) {
+        throw std::runtime_error("Truncated JSON array in response");
+    }
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,186 @@
+#include "hyperliquid/utils/json_writer.hpp"
+#include "hyperliquid/utils/latency.hpp"
+#include <algorithm>
+#include <charconv>
+#include <vector>
+
+namespace hyperliquid {
+
+namespace {
+
+template <typename Integer>
+void appendInteger(std::string& out, Integer value) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
+
+template <typename BasicJson>
+void appendValue(std::string& out, const BasicJson& value);
+
+template <typename BasicJson>
+void appendObject(std::string& out, const BasicJson& value) {
+    using Entry = typename BasicJson::object_t::value_type;
+
+    // Order entries by key; small objects avoid the heap
+    constexpr size_t INLINE_ENTRIES = 16;
+    const auto& object = value.template get_ref<const typename BasicJson::object_t&>();
+    const Entry* inline_entries[INLINE_ENTRIES];
+    std::vector<const Entry*> heap_entries;
+    const Entry** entries = inline_entries;
+    if (object.size() > INLINE_ENTRIES) {
+        heap_entries.resize(object.size());
+        entries = heap_entries.data();
+    }
+
+    size_t count = 0;
+    for (const auto& entry : object) {
+        entries[count++] = &entry;
+    }
+    std::sort(entries, entries + count, [](const Entry* a, const Entry* b) {
+        return a->first < b->first;
+    });
+
+    out.push_back('{');
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0) {
+            out.push_back(',');
+        }
+        appendJsonString(out, entries[i]->first);
+        out.push_back(':');
+        appendValue(out, entries[i]->second);
+    }
+    out.push_back('}');
+}
+
+template <typename BasicJson>
+void appendValue(std::string& out, const BasicJson& value) {
+    switch (value.type()) {
+        case nlohmann::json::value_t::object:
+            appendObject(out, value);
+            break;
+        case nlohmann::json::value_t::array: {
+            out.push_back('[');
+            bool first = true;
+            for (const auto& element : value) {
+                if (!first) {
+                    out.push_back(',');
+                }
+                first = false;
+                appendValue(out, element);
+            }
+            out.push_back(']');
+            break;
+        }
+        case nlohmann::json::value_t::string:
+            appendJsonString(out, value.template get_ref<const std::string&>());
+            break;
+        case nlohmann::json::value_t::boolean:
+            out.append(value.template get<bool>() ? "true" : "false");
+            break;
+        case nlohmann::json::value_t::null:
+            out.append("null");
+            break;
+        case nlohmann::json::value_t::number_integer:
+            appendInteger(out, value.template get<int64_t>());
+            break;
+        case nlohmann::json::value_t::number_unsigned:
+            appendInteger(out, value.template get<uint64_t>());
+            break;
+        default:
+            // Floats and anything exotic keep nlohmann's exact formatting
+            out.append(value.dump());
+            break;
+    }
+}
+
+template <typename BasicJson>
+void writePayload(std::string& out,
+                  const BasicJson& action,
+                  const Signature& signature,
+                  int64_t nonce,
+                  bool include_vault,
+                  const std::string& vault_address,
+                  std::optional<int64_t> expires_after) {
+    HYPERLIQUID_LATENCY_SCOPE(JsonDump);
+
+    out.clear();
+    out.append("{\"action\":");
+    appendValue(out, action);
+
+    out.append(",\"expiresAfter\":");
+    if (expires_after.has_value()) {
+        appendInteger(out, *expires_after);
+    } else {
+        out.append("null");
+    }
+
+    out.append(",\"nonce\":");
+    appendInteger(out, nonce);
+
+    out.append(",\"signature\":{\"r\":");
+    appendJsonString(out, signature.r);
+    out.append(",\"s\":");
+    appendJsonString(out, signature.s);
+    out.append(",\"v\":");
+    appendInteger(out, signature.v);
+    out.push_back('}');
+
+    if (include_vault) {
+        out.append(",\"vaultAddress\":");
+        if (vault_address.empty()) {
+            out.append("null");
+        } else {
+            appendJsonString(out, vault_address);
+        }
+    }
+    out.push_back('}');
+}
+
+} // namespace
+
+void appendJsonString(std::string& out, std::string_view value) {
+    // Plain ASCII without quotes, backslashes or control characters is
+    // copied verbatim; anything else goes through nlohmann for identical
+    // escaping and UTF-8 validation
+    for (char c : value) {
+        unsigned char byte = static_cast<unsigned char>(c);
+        if (byte < 0x20 || byte >= 0x80 || c == '"' || c == '\\') {
+            out.append(nlohmann::json(std::string(value)).dump());
+            return;
+        }
+    }
+    out.push_back('"');
+    out.append(value.data(), value.size());
+    out.push_back('"');
+}
+
+void appendJson(std::string& out, const nlohmann::json& value) {
+    appendValue(out, value);
+}
+
+void appendJson(std::string& out, const nlohmann::ordered_json& value) {
+    appendValue(out, value);
+}
+
+void writeExchangePayload(std::string& out,
+                          const nlohmann::json& action,
+                          const Signature& signature,
+                          int64_t nonce,
+                          bool include_vault,
+                          const std::string& vault_address,
+                          std::optional<int64_t> expires_after) {
+    writePayload(out, action, signature, nonce, include_vault, vault_address, expires_after);
+}
+
+void writeExchangePayload(std::string& out,
+                          const nlohmann::ordered_json& action,
+                          const Signature& signature,
+                          int64_t nonce,
+                          bool include_vault,
+                          const std::string& vault_address,
+                          std::optional<int64_t> expires_after) {
+    writePayload(out, action, signature, nonce, include_vault, vault_address, expires_after);
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,255 @@
+#include "hyperliquid/utils/latency.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace hyperliquid {
+
+namespace {
+
+constexpr int64_t SUB_BUCKET_COUNT = int64_t{1} << LatencyHistogram::SUB_BUCKET_BITS;
+constexpr int64_t SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+
+const char* PHASE_NAMES[LATENCY_PHASE_COUNT] = {
+    "name_resolution",
+    "rounding",
+    "msgpack",
+    "keccak",
+    "eip712",
+    "ecdsa",
+    "json_dump",
+    "curl_perform",
+    "json_parse",
+};
+
+int highestBit(uint64_t value) {
+    int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+
+/**
+ * Bucket counts for every phase; only the owning thread increments them
+ */
+struct ThreadRecorder {
+    std::vector<std::atomic<uint64_t>> counts;
+
+    ThreadRecorder() : counts(LATENCY_PHASE_COUNT * LatencyHistogram::BUCKET_COUNT) {}
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadRecorder>> active;
+    std::vector<std::unique_ptr<ThreadRecorder>> free;  // zeroed, from finished threads
+    ThreadRecorder retired;                             // counts of finished threads
+};
+
+Registry& registry() {
+    // Never destroyed: threads may still record during static destruction
+    static Registry* instance = new Registry();
+    return *instance;
+}
+
+ThreadRecorder* acquireRecorder() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (reg.free.empty()) {
+        reg.active.push_back(std::make_unique<ThreadRecorder>());
+    } else {
+        reg.active.push_back(std::move(reg.free.back()));
+        reg.free.pop_back();
+    }
+    return reg.active.back().get();
+}
+
+/**
+ * Fold a finished thread's counts into the retired totals and keep its
+ * recorder for the next thread, so short-lived threads do not grow the
+ * registry
+ */
+void releaseRecorder(ThreadRecorder* recorder) {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (size_t i = 0; i < recorder->counts.size(); ++i) {
+        uint64_t count = recorder->counts[i].exchange(0, std::memory_order_relaxed);
+        if (count != 0) {
+            reg.retired.counts[i].fetch_add(count, std::memory_order_relaxed);
+        }
+    }
+    auto it = std::find_if(reg.active.begin(), reg.active.end(),
+                           [recorder](const auto& owned) { return owned.get() == recorder; });
+    reg.free.push_back(std::move(*it));
+    reg.active.erase(it);
+}
+
+// Plain thread_locals stay usable after the lease below has been destroyed
+thread_local ThreadRecorder* t_recorder = nullptr;
+thread_local bool t_released = false;
+
+struct RecorderLease {
+    ~RecorderLease() {
+        if (t_recorder) {
+            releaseRecorder(t_recorder);
+            t_recorder = nullptr;
+        }
+        t_released = true;
+    }
+};
+
+/**
+ * The calling thread's recorder, taken from the registry on first use and
+ * returned when the thread exits
+ */
+ThreadRecorder& localRecorder() {
+    if (t_recorder) {
+        return *t_recorder;
+    }
+    if (t_released) {
+        // Recording from a thread_local destructor after the lease is gone
+        return registry().retired;
+    }
+    thread_local RecorderLease lease;
+    t_recorder = acquireRecorder();
+    return *t_recorder;
+}
+
+} // namespace
+
+const char* latencyPhaseName(LatencyPhase phase) {
+    size_t index = static_cast<size_t>(phase);
+    return index < LATENCY_PHASE_COUNT ? PHASE_NAMES[index] : "unknown";
+}
+
+size_t LatencyHistogram::bucketIndex(int64_t value_ns) {
+    int64_t value = std::min(std::max<int64_t>(value_ns, 0), MAX_VALUE_NS);
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+    // Each power of two above the linear range splits into SUB_BUCKET_HALF buckets
+    int shift = highestBit(static_cast<uint64_t>(value)) - (SUB_BUCKET_BITS - 1);
+    int64_t sub = value >> shift;
+    return static_cast<size_t>(SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF +
+                               (sub - SUB_BUCKET_HALF));
+}
+
+int64_t LatencyHistogram::bucketValue(size_t index) {
+    int64_t i = static_cast<int64_t>(index);
+    if (i < SUB_BUCKET_COUNT) {
+        return i;
+    }
+    int64_t offset = i - SUB_BUCKET_COUNT;
+    int shift = static_cast<int>(offset / SUB_BUCKET_HALF) + 1;
+    int64_t sub = offset % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    return sub << shift;
+}
+
+void LatencyHistogram::record(int64_t value_ns, uint64_t count) {
+    if (count == 0) {
+        return;
+    }
+    int64_t value = std::min(std::max<int64_t>(value_ns, 0), MAX_VALUE_NS);
+    if (counts_.empty()) {
+        counts_.assign(BUCKET_COUNT, 0);
+    }
+    counts_[bucketIndex(value)] += count;
+    if (count_ == 0 || value < min_) {
+        min_ = value;
+    }
+    max_ = std::max(max_, value);
+    count_ += count;
+    sum_ += value * static_cast<int64_t>(count);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.count_ == 0) {
+        return;
+    }
+    if (counts_.empty()) {
+        counts_.assign(BUCKET_COUNT, 0);
+    }
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+    count_ += other.count_;
+    sum_ += other.sum_;
+}
+
+void LatencyHistogram::reset() {
+    counts_.clear();
+    count_ = 0;
+    sum_ = 0;
+    min_ = 0;
+    max_ = 0;
+}
+
+double LatencyHistogram::mean() const {
+    return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+}
+
+int64_t LatencyHistogram::percentile(double q) const {
+    if (count_ == 0) {
+        return 0;
+    }
+    q = std::min(std::max(q, 0.0), 1.0);
+    uint64_t rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(count_)));
+    rank = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            return std::min(std::max(bucketValue(i), min_), max_);
+        }
+    }
+    return max_;
+}
+
+void recordLatency(LatencyPhase phase, int64_t value_ns) {
+    size_t slot = static_cast<size_t>(phase) * LatencyHistogram::BUCKET_COUNT +
+                  LatencyHistogram::bucketIndex(value_ns);
+    localRecorder().counts[slot].fetch_add(1, std::memory_order_relaxed);
+}
+
+LatencySnapshot latencySnapshot() {
+    LatencySnapshot snapshot;
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    std::vector<const ThreadRecorder*> recorders{&reg.retired};
+    for (const auto& recorder : reg.active) {
+        recorders.push_back(recorder.get());
+    }
+    for (const ThreadRecorder* recorder : recorders) {
+        for (size_t phase = 0; phase < LATENCY_PHASE_COUNT; ++phase) {
+            const auto* counts = &recorder->counts[phase * LatencyHistogram::BUCKET_COUNT];
+            for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+                uint64_t count = counts[i].load(std::memory_order_relaxed);
+                if (count != 0) {
+                    snapshot.phases[phase].record(LatencyHistogram::bucketValue(i), count);
+                }
+            }
+        }
+    }
+    return snapshot;
+}
+
+void resetLatency() {
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& count : reg.retired.counts) {
+        count.store(0, std::memory_order_relaxed);
+    }
+    for (const auto& recorder : reg.active) {
+        for (auto& count : recorder->counts) {
+            count.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,115 @@
+#include "hyperliquid/utils/nonce.hpp"
+#include "hyperliquid/utils/conversions.hpp"
+#include <algorithm>
+#include <cctype>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace hyperliquid {
+
+static_assert(std::atomic<int64_t>::is_always_lock_free,
+              "NonceManager requires lock-free 64-bit atomics");
+
+namespace {
+
+std::string lowercase(const std::string& value) {
+    std::string result = value;
+    std::transform(result.begin(), result.end(), result.begin(),
+                  [](unsigned char c) { return std::tolower(c); });
+    return result;
+}
+
+// Shared-memory names are limited to 31 chars on macOS, so hash the address
+std::string shmNameForAddress(const std::string& address) {
+    uint64_t hash = 0xcbf29ce484222325ULL;  // FNV-1a
+    for (unsigned char c : lowercase(address)) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return "/hlnonce-" + bytesToHex(reinterpret_cast<const uint8_t*>(&hash), sizeof(hash), false);
+}
+
+} // namespace
+
+NonceManager::NonceManager() : local_(0), counter_(&local_), mapping_(nullptr) {}
+
+NonceManager::NonceManager(const std::string& shm_name)
+    : local_(0), counter_(&local_), mapping_(nullptr) {
+#ifdef _WIN32
+    (void)shm_name;
+    throw std::runtime_error("Shared-memory nonce counters are not supported on Windows");
+#else
+    int fd = shm_open(shm_name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("shm_open failed for nonce counter " + shm_name);
+    }
+
+    // A freshly created segment is zero-filled, which is a valid atomic 0
+    if (ftruncate(fd, sizeof(std::atomic<int64_t>)) != 0) {
+        close(fd);
+        throw std::runtime_error("ftruncate failed for nonce counter " + shm_name);
+    }
+
+    void* mapping = mmap(nullptr, sizeof(std::atomic<int64_t>),
+                         PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("mmap failed for nonce counter " + shm_name);
+    }
+
+    mapping_ = mapping;
+    counter_ = static_cast<std::atomic<int64_t>*>(mapping);
+#endif
+}
+
+NonceManager::~NonceManager() {
+#ifndef _WIN32
+    if (mapping_) {
+        munmap(mapping_, sizeof(std::atomic<int64_t>));
+    }
+#endif
+}
+
+int64_t NonceManager::next() {
+    int64_t last = counter_->load(std::memory_order_relaxed);
+    while (true) {
+        int64_t candidate = std::max(getTimestampMs(), last + 1);
+        if (counter_->compare_exchange_weak(last, candidate,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_relaxed)) {
+            return candidate;
+        }
+    }
+}
+
+int64_t NonceManager::last() const {
+    return counter_->load(std::memory_order_acquire);
+}
+
+std::shared_ptr<NonceManager> NonceManager::forAddress(const std::string& address) {
+    static std::mutex registry_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<NonceManager>> registry;
+
+    std::string key = lowercase(address);
+
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    auto manager = registry[key].lock();
+    if (!manager) {
+        manager = std::make_shared<NonceManager>();
+        registry[key] = manager;
+    }
+    return manager;
+}
+
+std::shared_ptr<NonceManager> NonceManager::sharedMemory(const std::string& address) {
+    return std::shared_ptr<NonceManager>(new NonceManager(shmNameForAddress(address)));
+}
+
+} // namespace hyperliquid
@@ -1,5 +1,6 @@
 #include "hyperliquid/utils/signing.hpp"
 #include "hyperliquid/utils/conversions.hpp"
+#include "hyperliquid/utils/latency.hpp"
 #include <msgpack.hpp>
 #include <sstream>
 #include <stdexcept>
@@ -80,18 +81,51 @@ Signature Wallet::signMessage(const std::vector<uint8_t>& message_hash) const {
 
 // Action hash computation
 
+std::string packAction(const nlohmann::ordered_json& action) {
+    HYPERLIQUID_LATENCY_SCOPE(Msgpack);
+
+    std::stringstream ss;
+    msgpack::packer<std::stringstream> packer(ss);
+    packJson(packer, action);
+    return ss.str();
+}
+
+void appendMsgpackString(std::string& out, const std::string& value) {
+    size_t len = value.size();
+    if (len < 32) {
+        out.push_back(static_cast<char>(0xa0 | len));
+    } else if (len < 256) {
+        out.push_back(static_cast<char>(0xd9));
+        out.push_back(static_cast<char>(len));
+    } else if (len < 65536) {
+        out.push_back(static_cast<char>(0xda));
+        out.push_back(static_cast<char>((len >> 8) & 0xFF));
+        out.push_back(static_cast<char>(len & 0xFF));
+    } else {
+        out.push_back(static_cast<char>(0xdb));
+        for (int i = 3; i >= 0; --i) {
+            out.push_back(static_cast<char>((len >> (i * 8)) & 0xFF));
+        }
+    }
+    out.append(value);
+}
+
 std::vector<uint8_t> actionHash(const nlohmann::ordered_json& action,
                                 const std::optional<std::string>& vault_address,
                                 int64_t nonce,
                                 std::optional<int64_t> expires_after) {
+    return actionHashPacked(packAction(action), vault_address, nonce, expires_after);
+}
+
+std::vector<uint8_t> actionHashPacked(const std::string& packed_action,
+                                      const std::optional<std::string>& vault_address,
+                                      int64_t nonce,
+                                      std::optional<int64_t> expires_after) {
     std::vector<uint8_t> data;
+    data.reserve(packed_action.size() + 38);
 
-    // 1. Msgpack serialize the action
-    std::stringstream ss;
-    msgpack::packer<std::stringstream> packer(ss);
-    packJson(packer, action);
-    std::string msgpack_str = ss.str();
-    data.insert(data.end(), msgpack_str.begin(), msgpack_str.end());
+    // 1. Msgpack-serialized action
+    data.insert(data.end(), packed_action.begin(), packed_action.end());
 
     // 2. Append nonce (8 bytes, big-endian)
     for (int i = 7; i >= 0; --i) {
@@ -216,8 +250,18 @@ Signature signL1Action(const Wallet& wallet,
                       int64_t nonce,
                       std::optional<int64_t> expires_after,
                       bool is_mainnet) {
+    return signL1ActionPacked(wallet, packAction(action), vault_address, nonce,
+                              expires_after, is_mainnet);
+}
+
+Signature signL1ActionPacked(const Wallet& wallet,
+                             const std::string& packed_action,
+                             const std::optional<std::string>& vault_address,
+                             int64_t nonce,
+                             std::optional<int64_t> expires_after,
+                             bool is_mainnet) {
     // Compute action hash
-    auto hash = actionHash(action, vault_address, nonce, expires_after);
+    auto hash = actionHashPacked(packed_action, vault_address, nonce, expires_after);
 
     // Construct phantom agent
     auto phantom_agent = constructPhantomAgent(hash, is_mainnet);
@@ -0,0 +1,33 @@
+#include "hyperliquid/utils/symbol_table.hpp"
+#include <stdexcept>
+
+namespace hyperliquid {
+
+uint32_t SymbolTable::intern(std::string_view name) {
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+bool SymbolTable::find(std::string_view name, uint32_t& id) const {
+    auto it = ids_.find(name);
+    if (it == ids_.end()) {
+        return false;
+    }
+    id = it->second;
+    return true;
+}
+
+const std::string& SymbolTable::name(uint32_t id) const {
+    if (id >= names_.size()) {
+        throw std::out_of_range("Unknown symbol id: " + std::to_string(id));
+    }
+    return names_[id];
+}
+
+} // namespace hyperliquid
@@ -0,0 +1,157 @@
+#include "hyperliquid/account_snapshot.hpp"
+#include "hyperliquid/errors.hpp"
+#include "hyperliquid/info.hpp"
+#include "fixtures.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace hyperliquid {
+namespace {
+
+const std::unordered_map<std::string, int> COIN_TO_ASSET = {{"BTC", 0}, {"ETH", 1}};
+
+TEST(AccountSnapshotTest, MissingOrigSzFallsBackToSz) {
+    std::vector<OpenOrder> orders;
+    parseOpenOrders(test::readFixture("open_orders.json"), COIN_TO_ASSET, orders);
+
+    ASSERT_EQ(orders.size(), 2u);
+    EXPECT_EQ(orders[0].asset, 0);
+    EXPECT_EQ(orders[0].oid, 91490942);
+    EXPECT_FALSE(orders[0].is_buy);
+    EXPECT_EQ(orders[0].limit_px, 2979200000000);
+    EXPECT_EQ(orders[0].sz, 0);
+    EXPECT_EQ(orders[0].orig_sz, 0);
+    EXPECT_EQ(orders[0].timestamp, 1681247412573);
+
+    EXPECT_EQ(orders[1].asset, 1);
+    EXPECT_TRUE(orders[1].is_buy);
+    EXPECT_EQ(orders[1].sz, 125000000);
+    EXPECT_EQ(orders[1].orig_sz, 125000000);
+    EXPECT_FALSE(orders[1].cloid.has_value());
+}
+
+TEST(AccountSnapshotTest, DecodesOrigSzAndCloid) {
+    std::vector<OpenOrder> orders;
+    parseOpenOrders(test::readFixture("frontend_open_orders.json"), COIN_TO_ASSET, orders);
+
+    ASSERT_EQ(orders.size(), 2u);
+    EXPECT_EQ(orders[0].sz, 250000000);
+    EXPECT_EQ(orders[0].orig_sz, 500000000);
+    ASSERT_TRUE(orders[0].cloid.has_value());
+    EXPECT_EQ(orders[0].cloid->toRaw(), "0x1234567890abcdef1234567890abcdef");
+
+    // Kept with asset -1 when the coin is not in the metadata
+    EXPECT_EQ(orders[1].asset, -1);
+    EXPECT_EQ(orders[1].limit_px, 8000000);
+    EXPECT_EQ(orders[1].orig_sz, 10000000000);
+}
+
+TEST(AccountSnapshotTest, DecodesSpotBalances) {
+    std::vector<SpotBalance> balances;
+    parseSpotBalances(test::readFixture("spot_clearinghouse_state.json"), balances);
+
+    ASSERT_EQ(balances.size(), 2u);
+    EXPECT_EQ(balances[0].token, 0);
+    EXPECT_EQ(balances[0].total, 1462548500);
+    EXPECT_EQ(balances[0].hold, 0);
+    EXPECT_EQ(balances[1].token, 1);
+    EXPECT_EQ(balances[1].total, 200000000000);
+    EXPECT_EQ(balances[1].hold, 10000000000);
+    EXPECT_EQ(balances[1].entry_ntl, 123456000000);
+}
+
+TEST(AccountSnapshotTest, ThrowsOnMalformedBody) {
+    std::vector<OpenOrder> orders;
+    EXPECT_THROW(parseOpenOrders("[{\"coin\":", COIN_TO_ASSET, orders), std::runtime_error);
+    std::vector<SpotBalance> balances;
+    EXPECT_THROW(parseSpotBalances("{\"balances\":[", balances), std::runtime_error);
+}
+
+class AccountPollTest : public ::testing::Test {
+protected:
+    // clearinghouseState for B fails once, openOrders for C stalls once
+    AccountPollTest()
+        : server_([this](const std::string&, const std::string& body) { return reply(body); }),
+          info_(server_.url(), true, &meta_, &spot_meta_) {
+        info_.setRateLimiter(nullptr);
+        RetryPolicy policy;
+        policy.base_backoff = std::chrono::milliseconds(10);
+        policy.hedge = true;
+        policy.hedge_default_delay = std::chrono::milliseconds(50);
+        info_.setRetryPolicy(policy);
+    }
+
+    test::MockResponse reply(const std::string& body) {
+        auto request = nlohmann::json::parse(body);
+        std::string type = request["type"];
+        std::string user = request["user"];
+        int seen;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            seen = requests_[{type, user}]++;
+        }
+        if (type == "clearinghouseState") {
+            if (user == USER_B && seen == 0) {
+                return {502, "{}", {}};
+            }
+            if (user == USER_D) {
+                return {422, R"({"error":"Unprocessable"})", {}};
+            }
+            return {200, test::readFixture("clearinghouse_state.json"), {}};
+        }
+        if (user == USER_C && seen == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(600));
+        }
+        return {200, test::readFixture("open_orders.json"), {}};
+    }
+
+    static Meta makeMeta() {
+        Meta meta;
+        meta.universe = {{"BTC", 5}, {"ETH", 4}};
+        return meta;
+    }
+
+    static constexpr const char* USER_A = "0x000000000000000000000000000000000000000a";
+    static constexpr const char* USER_B = "0x000000000000000000000000000000000000000b";
+    static constexpr const char* USER_C = "0x000000000000000000000000000000000000000c";
+    static constexpr const char* USER_D = "0x000000000000000000000000000000000000000d";
+
+    std::mutex mutex_;
+    std::map<std::pair<std::string, std::string>, int> requests_;
+    test::MockServer server_;
+    Meta meta_ = makeMeta();
+    SpotMeta spot_meta_;
+    Info info_;
+};
+
+TEST_F(AccountPollTest, RetriesAndHedgesEachQuery) {
+    auto start = std::chrono::steady_clock::now();
+    auto snapshots = info_.accountSnapshots({{USER_A}, {USER_B}, {USER_C}}, 2);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(400));
+
+    ASSERT_EQ(snapshots.size(), 3u);
+    auto expected = info_.accountSnapshots({{USER_A}}, 1)[0];
+    for (const auto& snapshot : snapshots) {
+        EXPECT_EQ(snapshot.state.withdrawable, expected.state.withdrawable);
+        EXPECT_EQ(snapshot.state.positions.size(), expected.state.positions.size());
+        EXPECT_EQ(snapshot.open_orders.size(), 2u);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_EQ((requests_[{"clearinghouseState", USER_B}]), 2);
+    EXPECT_EQ((requests_[{"openOrders", USER_C}]), 2);
+}
+
+TEST_F(AccountPollTest, ClientErrorsAreNotRetried) {
+    EXPECT_THROW(info_.accountSnapshots({{USER_A}, {USER_D}}), ClientError);
+    std::lock_guard<std::mutex> lock(mutex_);
+    EXPECT_EQ((requests_[{"clearinghouseState", USER_D}]), 1);
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,97 @@
+#include "hyperliquid/action_response.hpp"
+#include "fixtures.hpp"
+#include <gtest/gtest.h>
+
+namespace hyperliquid {
+namespace {
+
+const Cloid RESTING_CLOID("0x1234567890abcdef1234567890abcdef");
+
+void expectOrderStatuses(const ActionResponse& ack) {
+    ASSERT_TRUE(ack.ok);
+    EXPECT_EQ(ack.type, "order");
+    ASSERT_EQ(ack.statuses.size(), 4u);
+
+    const auto* resting = std::get_if<RestingStatus>(&ack.statuses[0]);
+    ASSERT_NE(resting, nullptr);
+    EXPECT_EQ(resting->oid, 77738308);
+    ASSERT_TRUE(resting->cloid.has_value());
+    EXPECT_EQ(resting->cloid->toRaw(), RESTING_CLOID.toRaw());
+
+    const auto* filled = std::get_if<FilledStatus>(&ack.statuses[1]);
+    ASSERT_NE(filled, nullptr);
+    EXPECT_EQ(filled->oid, 77747314);
+    EXPECT_EQ(filled->total_sz, 2000000);       // 0.02
+    EXPECT_EQ(filled->avg_px, 189140000000);    // 1891.4
+    EXPECT_FALSE(filled->cloid.has_value());
+
+    const auto* error = std::get_if<ErrorStatus>(&ack.statuses[2]);
+    ASSERT_NE(error, nullptr);
+    EXPECT_EQ(error->message, "Order must have minimum value of $10.");
+
+    const auto* ack_status = std::get_if<AckStatus>(&ack.statuses[3]);
+    ASSERT_NE(ack_status, nullptr);
+    EXPECT_EQ(ack_status->status, "waitingForFill");
+}
+
+TEST(ActionResponseTest, DecodesEveryOrderStatus) {
+    ActionResponse ack;
+    parseActionResponse(test::readFixture("exchange_order.json"), ack);
+    expectOrderStatuses(ack);
+}
+
+TEST(ActionResponseTest, DecodesCancelStatuses) {
+    ActionResponse ack;
+    parseActionResponse(test::readFixture("exchange_cancel.json"), ack);
+    ASSERT_TRUE(ack.ok);
+    EXPECT_EQ(ack.type, "cancel");
+    ASSERT_EQ(ack.statuses.size(), 2u);
+    ASSERT_TRUE(std::holds_alternative<AckStatus>(ack.statuses[0]));
+    EXPECT_EQ(std::get<AckStatus>(ack.statuses[0]).status, "success");
+    ASSERT_TRUE(std::holds_alternative<ErrorStatus>(ack.statuses[1]));
+    EXPECT_NE(std::get<ErrorStatus>(ack.statuses[1]).message.find("already canceled"), std::string::npos);
+}
+
+TEST(ActionResponseTest, DecodesRejectedAction) {
+    ActionResponse ack;
+    parseActionResponse(test::readFixture("exchange_err.json"), ack);
+    EXPECT_FALSE(ack.ok);
+    EXPECT_EQ(ack.error, "User or API Wallet 0x0000000000000000000000000000000000000001 does not exist.");
+    EXPECT_TRUE(ack.type.empty());
+    EXPECT_TRUE(ack.statuses.empty());
+}
+
+TEST(ActionResponseTest, DecodesDefaultResponse) {
+    ActionResponse ack;
+    parseActionResponse(test::readFixture("exchange_default.json"), ack);
+    EXPECT_TRUE(ack.ok);
+    EXPECT_EQ(ack.type, "default");
+    EXPECT_TRUE(ack.statuses.empty());
+}
+
+TEST(ActionResponseTest, ReuseClearsPreviousResult) {
+    ActionResponse ack;
+    parseActionResponse(test::readFixture("exchange_order.json"), ack);
+    parseActionResponse(test::readFixture("exchange_err.json"), ack);
+    EXPECT_FALSE(ack.ok);
+    EXPECT_TRUE(ack.statuses.empty());
+}
+
+TEST(ActionResponseTest, ThrowsOnMalformedBody) {
+    ActionResponse ack;
+    EXPECT_THROW(parseActionResponse("{\"status\":\"ok\",", ack), std::runtime_error);
+}
+
+TEST(ActionResponseTest, JsonDecodeMatchesSaxDecode) {
+    ActionResponse ack;
+    actionResponseFromJson(nlohmann::json::parse(test::readFixture("exchange_order.json")), ack);
+    expectOrderStatuses(ack);
+
+    actionResponseFromJson(nlohmann::json::parse(test::readFixture("exchange_err.json")), ack);
+    EXPECT_FALSE(ack.ok);
+    EXPECT_EQ(ack.error, "User or API Wallet 0x0000000000000000000000000000000000000001 does not exist.");
+    EXPECT_TRUE(ack.statuses.empty());
+}
+
+} // namespace
+} // namespace hyperliquid
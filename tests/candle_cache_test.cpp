@@ -0,0 +1,130 @@
+#include "hyperliquid/candle_cache.hpp"
+#include "hyperliquid/info.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+constexpr int64_t MINUTE = 60 * 1000;
+constexpr int64_t LISTED_AT = 100 * MINUTE;  // no candles before this
+
+// candleSnapshot over 1m candles from LISTED_AT on; records each [start, end]
+class CandleServer {
+public:
+    CandleServer() : server_([this](const std::string&, const std::string& body) { return handle(body); }) {}
+
+    std::string url() const { return server_.url(); }
+
+    std::vector<std::pair<int64_t, int64_t>> takeRequests() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::move(requests_);
+    }
+
+private:
+    test::MockResponse handle(const std::string& body) {
+        auto req = nlohmann::json::parse(body)["req"];
+        int64_t start = req["startTime"];
+        int64_t end = req["endTime"];
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            requests_.emplace_back(start, end);
+        }
+
+        nlohmann::json candles = nlohmann::json::array();
+        int64_t first = std::max(LISTED_AT, (start + MINUTE - 1) / MINUTE * MINUTE);
+        for (int64_t t = first; t <= end; t += MINUTE) {
+            std::string px = std::to_string(t / MINUTE);
+            candles.push_back({
+                {"t", t}, {"T", t + MINUTE - 1}, {"s", req["coin"]}, {"i", "1m"},
+                {"o", px}, {"c", px}, {"h", px}, {"l", px}, {"v", "1.0"}, {"n", 1}
+            });
+        }
+        return {200, candles.dump(), {}};
+    }
+
+    std::mutex mutex_;
+    std::vector<std::pair<int64_t, int64_t>> requests_;
+    test::MockServer server_;
+};
+
+class CandleCacheTest : public ::testing::Test {
+protected:
+    CandleCacheTest()
+        : directory_(::testing::TempDir() + "hyperliquid_candles_" +
+                     ::testing::UnitTest::GetInstance()->current_test_info()->name()),
+          info_(server_.url(), true, &meta_, &spot_meta_) {
+        std::filesystem::remove_all(directory_);
+        info_.setRateLimiter(nullptr);
+    }
+
+    ~CandleCacheTest() override {
+        std::filesystem::remove_all(directory_);
+    }
+
+    static Meta makeMeta() {
+        Meta meta;
+        meta.universe = {{"BTC", 5}};
+        return meta;
+    }
+
+    CandleServer server_;
+    std::string directory_;
+    Meta meta_ = makeMeta();
+    SpotMeta spot_meta_;
+    Info info_;
+};
+
+TEST_F(CandleCacheTest, ServesCoveredRangesFromDisk) {
+    CandleCache cache(info_, directory_);
+    Candles first = cache.load("BTC", "1m", 200 * MINUTE, 209 * MINUTE);
+    ASSERT_EQ(first.size(), 10u);
+    EXPECT_EQ(server_.takeRequests().size(), 1u);
+
+    CandleCache reopened(info_, directory_);
+    Candles again = reopened.load("BTC", "1m", 202 * MINUTE, 205 * MINUTE);
+    EXPECT_TRUE(server_.takeRequests().empty());
+    ASSERT_EQ(again.size(), 4u);
+    EXPECT_EQ(again.time.front(), 202 * MINUTE);
+    EXPECT_DOUBLE_EQ(again.close.back(), 205.0);
+}
+
+TEST_F(CandleCacheTest, FetchesOnlyTheMissingEdgesAndMerges) {
+    CandleCache cache(info_, directory_);
+    cache.load("BTC", "1m", 200 * MINUTE, 209 * MINUTE);
+    server_.takeRequests();
+
+    Candles wider = cache.load("BTC", "1m", 195 * MINUTE, 214 * MINUTE);
+    auto requests = server_.takeRequests();
+    ASSERT_EQ(requests.size(), 2u);
+    EXPECT_EQ(requests[0], std::make_pair(195 * MINUTE, 200 * MINUTE - 1));
+    EXPECT_EQ(requests[1], std::make_pair(209 * MINUTE + 1, 214 * MINUTE));
+
+    ASSERT_EQ(wider.size(), 20u);
+    for (size_t i = 0; i < wider.size(); ++i) {
+        EXPECT_EQ(wider.time[i], (195 + static_cast<int64_t>(i)) * MINUTE);
+    }
+}
+
+TEST_F(CandleCacheTest, RecordsCoverageForEmptyExtensions) {
+    CandleCache cache(info_, directory_);
+    cache.load("BTC", "1m", 100 * MINUTE, 109 * MINUTE);
+    server_.takeRequests();
+
+    // Before listing: the extension returns nothing but still completes
+    Candles earlier = cache.load("BTC", "1m", 50 * MINUTE, 109 * MINUTE);
+    EXPECT_EQ(earlier.size(), 10u);
+    EXPECT_EQ(server_.takeRequests().size(), 1u);
+
+    cache.load("BTC", "1m", 50 * MINUTE, 109 * MINUTE);
+    EXPECT_TRUE(server_.takeRequests().empty());
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,74 @@
+#include "hyperliquid/clearinghouse.hpp"
+#include "fixtures.hpp"
+#include <gtest/gtest.h>
+
+namespace hyperliquid {
+namespace {
+
+const std::unordered_map<std::string, int> COIN_TO_ASSET = {{"BTC", 0}, {"ETH", 1}};
+
+TEST(ClearinghouseTest, DecodesMarginSummary) {
+    ClearinghouseState state;
+    parseClearinghouseState(test::readFixture("clearinghouse_state.json"), COIN_TO_ASSET, state);
+
+    EXPECT_EQ(state.margin_summary.account_value, 1310451450200);
+    EXPECT_EQ(state.margin_summary.total_ntl_pos, 223120000);
+    EXPECT_EQ(state.cross_margin_summary.total_margin_used, 22312000);
+    EXPECT_EQ(state.cross_maintenance_margin_used, 7410000);
+    EXPECT_EQ(state.withdrawable, 1310429138200);
+    EXPECT_EQ(state.time, 1708622398623);
+}
+
+TEST(ClearinghouseTest, NullLiquidationPxIsZero) {
+    ClearinghouseState state;
+    parseClearinghouseState(test::readFixture("clearinghouse_state.json"), COIN_TO_ASSET, state);
+
+    const AssetPosition* eth = state.position(1);
+    ASSERT_NE(eth, nullptr);
+    EXPECT_EQ(eth->szi, -120000);
+    EXPECT_EQ(eth->entry_px, 185935000000);
+    EXPECT_EQ(eth->liquidation_px, 0);
+    EXPECT_TRUE(eth->is_cross);
+    EXPECT_EQ(eth->leverage, 10);
+    EXPECT_EQ(eth->max_leverage, 50);
+    EXPECT_EQ(eth->cum_funding_all_time, 51408541700);
+}
+
+TEST(ClearinghouseTest, DecodesIsolatedPosition) {
+    ClearinghouseState state;
+    parseClearinghouseState(test::readFixture("clearinghouse_state.json"), COIN_TO_ASSET, state);
+
+    const AssetPosition* btc = state.position(0);
+    ASSERT_NE(btc, nullptr);
+    EXPECT_EQ(btc->szi, 50000000);
+    EXPECT_EQ(btc->liquidation_px, 4100050000000);
+    EXPECT_FALSE(btc->is_cross);
+    EXPECT_EQ(btc->leverage, 5);
+    EXPECT_EQ(btc->cum_funding_since_open, -125000000);
+
+    ASSERT_EQ(state.active.size(), 2u);
+    EXPECT_EQ(state.active[0], 1);
+    EXPECT_EQ(state.active[1], 0);
+}
+
+TEST(ClearinghouseTest, SkipsUnknownCoins) {
+    ClearinghouseState state;
+    parseClearinghouseState(test::readFixture("clearinghouse_state.json"), {{"BTC", 0}}, state);
+
+    EXPECT_EQ(state.position(1), nullptr);
+    ASSERT_EQ(state.active.size(), 1u);
+    EXPECT_EQ(state.active[0], 0);
+}
+
+TEST(ClearinghouseTest, RefillResetsPreviousPositions) {
+    ClearinghouseState state;
+    parseClearinghouseState(test::readFixture("clearinghouse_state.json"), COIN_TO_ASSET, state);
+    parseClearinghouseState("{\"assetPositions\":[],\"time\":1}", COIN_TO_ASSET, state);
+
+    EXPECT_TRUE(state.active.empty());
+    EXPECT_EQ(state.position(0), nullptr);
+    EXPECT_EQ(state.margin_summary.account_value, 0);
+}
+
+} // namespace
+} // namespace hyperliquid
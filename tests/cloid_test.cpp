@@ -0,0 +1,51 @@
+#include "hyperliquid/types.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+namespace hyperliquid {
+namespace {
+
+TEST(CloidTest, RoundTripsThroughTheWireFormat) {
+    const std::string raw = "0x0123456789abcdeffedcba9876543210";
+    Cloid cloid(raw);
+    EXPECT_EQ(cloid.hi(), 0x0123456789abcdefULL);
+    EXPECT_EQ(cloid.lo(), 0xfedcba9876543210ULL);
+    EXPECT_EQ(cloid.toRaw(), raw);
+    EXPECT_EQ(Cloid(cloid.toRaw()), cloid);
+
+    char buffer[Cloid::RAW_LENGTH];
+    cloid.toRaw(buffer);
+    EXPECT_EQ(std::string(buffer, Cloid::RAW_LENGTH), raw);
+}
+
+TEST(CloidTest, ParsesMixedCaseAndFormatsLowercase) {
+    Cloid mixed("0xABCDEFabcdef0123456789AbCdEf0000");
+    EXPECT_EQ(mixed, Cloid("0xabcdefabcdef0123456789abcdef0000"));
+    EXPECT_EQ(mixed.toRaw(), "0xabcdefabcdef0123456789abcdef0000");
+}
+
+TEST(CloidTest, FromIntAndFromStr) {
+    EXPECT_EQ(Cloid::fromInt(255).toRaw(), "0x000000000000000000000000000000ff");
+    EXPECT_EQ(Cloid::fromStr("000000000000000000000000000000ff"), Cloid::fromInt(255));
+    EXPECT_EQ(Cloid::fromStr("0x000000000000000000000000000000FF"), Cloid::fromInt(255));
+}
+
+TEST(CloidTest, RejectsMalformedInput) {
+    EXPECT_THROW(Cloid("0x1234"), std::invalid_argument);
+    EXPECT_THROW(Cloid("1x0123456789abcdeffedcba9876543210"), std::invalid_argument);
+    EXPECT_THROW(Cloid("0x0123456789abcdeffedcba987654321g"), std::invalid_argument);
+}
+
+TEST(CloidTest, GeneratorIsStrictlyIncreasing) {
+    CloidGenerator generator(42);
+    Cloid previous = generator.next();
+    for (int i = 0; i < 1000; ++i) {
+        Cloid current = generator.next();
+        EXPECT_LT(previous, current);
+        EXPECT_EQ(current.hi(), 42u);
+        previous = current;
+    }
+}
+
+} // namespace
+} // namespace hyperliquid
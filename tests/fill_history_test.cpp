@@ -0,0 +1,128 @@
+#include "hyperliquid/fill_history.hpp"
+#include "hyperliquid/info.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+const std::string USER = "0x0000000000000000000000000000000000000001";
+
+struct ServerFill {
+    int64_t time;
+    int64_t tid;
+    char hash_digit;
+};
+
+nlohmann::json fillJson(const ServerFill& fill) {
+    return {
+        {"coin", "BTC"}, {"px", "50000.0"}, {"sz", "0.01"}, {"side", "B"},
+        {"time", fill.time}, {"startPosition", "0.0"}, {"dir", "Open Long"},
+        {"closedPnl", "0.0"}, {"hash", "0x" + std::string(64, fill.hash_digit)},
+        {"oid", 1000 + fill.tid}, {"crossed", true}, {"fee", "0.1"},
+        {"tid", fill.tid}, {"feeToken", "USDC"}
+    };
+}
+
+// userFillsByTime over a fixed fill list, at most page_limit fills per reply.
+// overlap_ms widens every window to the left, as if the server's bounds
+// overlapped, so boundary fills come back twice.
+test::MockServer fillServer(std::vector<ServerFill> fills, size_t page_limit, int64_t overlap_ms = 0) {
+    return test::MockServer([=](const std::string&, const std::string& body) {
+        auto request = nlohmann::json::parse(body);
+        int64_t start = request["startTime"].get<int64_t>() - overlap_ms;
+        int64_t end = request["endTime"];
+        nlohmann::json reply = nlohmann::json::array();
+        for (const auto& fill : fills) {
+            if (fill.time >= start && fill.time <= end && reply.size() < page_limit) {
+                reply.push_back(fillJson(fill));
+            }
+        }
+        return test::MockResponse{200, reply.dump(), {}};
+    });
+}
+
+FillHistoryOptions smallPages(size_t page_limit) {
+    FillHistoryOptions options;
+    options.window_ms = 10000;
+    options.page_limit = page_limit;
+    return options;
+}
+
+std::vector<Fill> fetchAll(FillHistory& history, int64_t start, int64_t end) {
+    SymbolTable symbols;
+    std::vector<Fill> delivered;
+    history.fetch(USER, start, end, symbols, [&delivered](const Fill& fill) { delivered.push_back(fill); });
+    return delivered;
+}
+
+TEST(FillHistoryTest, SplitsFullWindowsAndDeliversInOrder) {
+    std::vector<ServerFill> fills;
+    for (int64_t i = 0; i < 10; ++i) {
+        fills.push_back({i * 100, i, 'a'});
+    }
+    Meta meta;
+    SpotMeta spot_meta;
+    auto server = fillServer(fills, 4);
+    Info info(server.url(), true, &meta, &spot_meta);
+    info.setRateLimiter(nullptr);
+    FillHistory history(info, smallPages(4));
+
+    auto delivered = fetchAll(history, 0, 9999);
+    ASSERT_EQ(delivered.size(), 10u);
+    for (int64_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(delivered[i].tid, i);
+    }
+    EXPECT_FALSE(history.truncated());
+}
+
+TEST(FillHistoryTest, FlagsAFullSingleMillisecond) {
+    std::vector<ServerFill> fills;
+    for (int64_t i = 0; i < 6; ++i) {
+        fills.push_back({500, i, 'a'});
+    }
+    Meta meta;
+    SpotMeta spot_meta;
+    auto server = fillServer(fills, 4);
+    Info info(server.url(), true, &meta, &spot_meta);
+    info.setRateLimiter(nullptr);
+    FillHistory history(info, smallPages(4));
+
+    auto delivered = fetchAll(history, 0, 9999);
+    EXPECT_EQ(delivered.size(), 4u);
+    EXPECT_TRUE(history.truncated());
+
+    // The flag describes the last fetch only
+    fetchAll(history, 0, 400);
+    EXPECT_FALSE(history.truncated());
+}
+
+TEST(FillHistoryTest, DeDuplicatesByTidAndHashAcrossWindows) {
+    std::vector<ServerFill> fills = {
+        {100, 1, 'a'},
+        {9999, 2, 'b'},   // last millisecond of the first window
+        {10000, 3, 'c'},
+        {10000, 3, 'd'},  // same tid, different transaction
+        {15000, 4, 'e'},
+    };
+    Meta meta;
+    SpotMeta spot_meta;
+    auto server = fillServer(fills, 100, 1);
+    Info info(server.url(), true, &meta, &spot_meta);
+    info.setRateLimiter(nullptr);
+    FillHistory history(info, smallPages(100));
+
+    auto delivered = fetchAll(history, 0, 19999);
+    std::vector<int64_t> tids;
+    for (const auto& fill : delivered) {
+        tids.push_back(fill.tid);
+    }
+    EXPECT_EQ(tids, (std::vector<int64_t>{1, 2, 3, 3, 4}));
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace hyperliquid {
+namespace test {
+
+/**
+ * Contents of a recorded response in tests/fixtures
+ */
+inline std::string readFixture(const std::string& name) {
+    std::ifstream in(std::string(HYPERLIQUID_FIXTURE_DIR) + "/" + name);
+    if (!in) {
+        throw std::runtime_error("Missing fixture: " + name);
+    }
+    std::ostringstream out;
+    out << in.rdbuf();
+    return out.str();
+}
+
+/**
+ * Base URL that refuses connections, for clients that must not reach a server
+ */
+inline std::string unreachableUrl() {
+    return "http://127.0.0.1:9";
+}
+
+} // namespace test
+} // namespace hyperliquid
@@ -0,0 +1,107 @@
+#include "hyperliquid/funding.hpp"
+#include "hyperliquid/info.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+constexpr int64_t HOUR = 60 * 60 * 1000;
+const std::vector<std::string> PAYMENT_COINS = {"BTC", "ETH", "SOL", "DOGE", "ARB", "OP", "APT"};
+
+// fundingHistory: one rate per hour for BTC, ETH only for its first 10 hours.
+// userFunding: one payment per coin per hour. Both cut at PAGE_LIMIT entries.
+test::MockResponse fundingReply(const std::string& body) {
+    auto request = nlohmann::json::parse(body);
+    int64_t start = request["startTime"];
+    int64_t end = request["endTime"];
+    int64_t first = (start + HOUR - 1) / HOUR * HOUR;
+
+    nlohmann::json entries = nlohmann::json::array();
+    auto full = [&entries]() { return entries.size() >= FundingLoader::PAGE_LIMIT; };
+
+    if (request["type"] == "userFunding") {
+        for (int64_t t = first; t <= end && !full(); t += HOUR) {
+            for (const auto& coin : PAYMENT_COINS) {
+                if (full()) {
+                    break;
+                }
+                entries.push_back({
+                    {"time", t}, {"hash", "0x0"},
+                    {"delta", {{"type", "funding"}, {"coin", coin}, {"usdc", "-1.5"},
+                               {"szi", "2.0"}, {"fundingRate", "0.0001"}}}
+                });
+            }
+        }
+    } else {
+        std::string coin = request["coin"];
+        int64_t last = coin == "ETH" ? 9 * HOUR : end;
+        for (int64_t t = first; t <= std::min(end, last) && !full(); t += HOUR) {
+            entries.push_back({{"coin", coin}, {"fundingRate", "0.0001"}, {"premium", "0.0002"}, {"time", t}});
+        }
+    }
+    return {200, entries.dump(), {}};
+}
+
+class FundingLoaderTest : public ::testing::Test {
+protected:
+    FundingLoaderTest()
+        : server_([](const std::string&, const std::string& body) { return fundingReply(body); }),
+          info_(server_.url(), true, &meta_, &spot_meta_) {
+        info_.setRateLimiter(nullptr);
+    }
+
+    static Meta makeMeta() {
+        Meta meta;
+        meta.universe = {{"BTC", 5}, {"ETH", 4}};
+        return meta;
+    }
+
+    test::MockServer server_;
+    Meta meta_ = makeMeta();
+    SpotMeta spot_meta_;
+    Info info_;
+};
+
+TEST_F(FundingLoaderTest, PagesRatesWithoutDuplicates) {
+    FundingLoader loader(info_);
+    auto series = loader.load({"BTC", "ETH"}, 0, 1199 * HOUR);
+    ASSERT_EQ(series.size(), 2u);
+
+    // 1200 hourly rates take three pages; each page boundary is requested twice
+    ASSERT_EQ(series[0].size(), 1200u);
+    for (size_t i = 0; i < series[0].size(); ++i) {
+        ASSERT_EQ(series[0].time[i], static_cast<int64_t>(i) * HOUR);
+    }
+    EXPECT_DOUBLE_EQ(cumulativeFunding(series[0], 0, 99 * HOUR), 0.01);
+
+    EXPECT_EQ(series[1].coin, "ETH");
+    EXPECT_EQ(series[1].size(), 10u);
+    EXPECT_EQ(server_.requestCount(), 4u);  // BTC x3, ETH x1
+}
+
+TEST_F(FundingLoaderTest, PagesPaymentsSplitMidHour) {
+    // 500 is not a multiple of 7 coins, so pages end part way through an hour
+    FundingLoader loader(info_);
+    SymbolTable symbols;
+    auto users = loader.loadUsers({"0x0000000000000000000000000000000000000001"}, 0, 299 * HOUR, symbols);
+    ASSERT_EQ(users.size(), 1u);
+    const UserFunding& payments = users[0];
+
+    ASSERT_EQ(payments.size(), 300 * PAYMENT_COINS.size());
+    std::set<std::pair<int64_t, uint32_t>> seen;
+    for (size_t i = 0; i < payments.size(); ++i) {
+        EXPECT_TRUE(seen.emplace(payments.time[i], payments.coin[i]).second);
+        if (i > 0) {
+            EXPECT_LE(payments.time[i - 1], payments.time[i]);
+        }
+    }
+}
+
+} // namespace
+} // namespace hyperliquid
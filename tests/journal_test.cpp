@@ -0,0 +1,113 @@
+#include "hyperliquid/info.hpp"
+#include "hyperliquid/journal.hpp"
+#include "hyperliquid/order_manager.hpp"
+#include "fixtures.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+class JournalTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = ::testing::TempDir() + "hyperliquid_journal_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+        std::remove(path_.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+    size_t fileSize() const {
+        std::ifstream in(path_, std::ios::binary | std::ios::ate);
+        return static_cast<size_t>(in.tellg());
+    }
+
+    Fill makeFill(SymbolTable& symbols, int64_t time, int64_t tid) const {
+        Fill fill;
+        fill.coin = symbols.intern("BTC");
+        fill.dir = symbols.intern("Open Long");
+        fill.fee_token = symbols.intern("USDC");
+        fill.px = 5000000000000;
+        fill.sz = 1000000;
+        fill.time = time;
+        fill.oid = 100 + tid;
+        fill.tid = tid;
+        fill.hash.fill(static_cast<uint8_t>(tid));
+        return fill;
+    }
+
+    std::string path_;
+};
+
+TEST_F(JournalTest, TruncatesATornTailOnRecovery) {
+    SymbolTable symbols;
+    {
+        JournalWriter writer(path_);
+        writer.appendFill(makeFill(symbols, 1000, 1), symbols);
+        writer.appendFill(makeFill(symbols, 2000, 2), symbols);
+    }
+    size_t intact = fileSize();
+    ASSERT_EQ(intact % sizeof(JournalRecord), 0u);
+
+    // A crash in the middle of a record write
+    {
+        std::ofstream out(path_, std::ios::binary | std::ios::app);
+        std::vector<char> partial(sizeof(JournalRecord) / 2, '\x7f');
+        out.write(partial.data(), static_cast<std::streamsize>(partial.size()));
+    }
+    ASSERT_EQ(fileSize(), intact + sizeof(JournalRecord) / 2);
+
+    {
+        JournalWriter writer(path_);
+        EXPECT_EQ(fileSize(), intact);
+        EXPECT_EQ(writer.lastFillTime(), 2000);
+        writer.appendFill(makeFill(symbols, 3000, 3), symbols);
+    }
+
+    JournalReader reader(path_);
+    std::vector<int64_t> tids;
+    reader.fillsBetween(0, 10000, [&tids](const Fill& fill) { tids.push_back(fill.tid); });
+    EXPECT_EQ(tids, (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_EQ(reader.lastFillTime(), 3000);
+    EXPECT_EQ(reader.symbols().name(reader.toFill(reader.record(reader.recordCount() - 1)).coin), "BTC");
+}
+
+TEST_F(JournalTest, RecordsOrderManagerStateChanges) {
+    Meta meta;
+    meta.universe = {{"BTC", 5}};
+    SpotMeta spot_meta;
+    Info info(test::unreachableUrl(), true, &meta, &spot_meta);
+
+    auto journal = std::make_shared<JournalWriter>(path_);
+    OrderManager manager;
+    manager.setJournal(journal);
+
+    OrderType type;
+    type.limit = LimitOrderType{"Gtc"};
+    ActionResponse placed;
+    placed.ok = true;
+    placed.statuses.push_back(RestingStatus{42, std::nullopt});
+    manager.onOrderResponse({OrderRequest{"BTC", true, 0.5, 50000.0, type, false, std::nullopt}}, {0}, placed, info);
+
+    ActionResponse canceled;
+    canceled.ok = true;
+    canceled.statuses.push_back(AckStatus{"success"});
+    manager.onCancelResponse({int64_t{42}}, canceled);
+    journal->flush();
+
+    JournalReader reader(path_);
+    std::vector<std::pair<int64_t, OrderState>> events;
+    reader.orderEvents([&events](const TrackedOrder& order) { events.emplace_back(order.oid, order.state); });
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0], std::make_pair(int64_t{42}, OrderState::Resting));
+    EXPECT_EQ(events[1], std::make_pair(int64_t{42}, OrderState::Canceled));
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,112 @@
+#include "hyperliquid/utils/json_writer.hpp"
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+namespace hyperliquid {
+namespace {
+
+const Signature SIGNATURE{"0x" + std::string(64, 'a'), "0x" + std::string(64, 'b'), 27};
+const int64_t NONCE = 1700000000123;
+
+// The request body as Exchange built it before writeExchangePayload
+std::string referencePayload(const nlohmann::ordered_json& action,
+                             bool include_vault,
+                             const std::string& vault_address,
+                             std::optional<int64_t> expires_after) {
+    nlohmann::json payload = {
+        {"action", action},
+        {"nonce", NONCE},
+        {"signature", SIGNATURE.toJson()}
+    };
+    if (include_vault) {
+        payload["vaultAddress"] = vault_address.empty() ? nlohmann::json(nullptr) : nlohmann::json(vault_address);
+    }
+    payload["expiresAfter"] = expires_after.has_value() ? nlohmann::json(*expires_after) : nlohmann::json(nullptr);
+    return payload.dump();
+}
+
+void expectMatchesDump(const nlohmann::ordered_json& action,
+                       bool include_vault = true,
+                       const std::string& vault_address = "",
+                       std::optional<int64_t> expires_after = std::nullopt) {
+    std::string written = "stale contents";
+    writeExchangePayload(written, action, SIGNATURE, NONCE, include_vault, vault_address, expires_after);
+    EXPECT_EQ(written, referencePayload(action, include_vault, vault_address, expires_after));
+
+    // The nlohmann::json overload takes the same path
+    writeExchangePayload(written, nlohmann::json(action), SIGNATURE, NONCE, include_vault, vault_address, expires_after);
+    EXPECT_EQ(written, referencePayload(action, include_vault, vault_address, expires_after));
+}
+
+nlohmann::ordered_json orderAction() {
+    nlohmann::ordered_json order = {
+        {"a", 0}, {"b", true}, {"p", "50000"}, {"s", "0.01"}, {"r", false},
+        {"t", {{"limit", {{"tif", "Gtc"}}}}},
+        {"c", "0x00000000000000000000000000000abc"}
+    };
+    return {{"type", "order"}, {"orders", {order}}, {"grouping", "na"}};
+}
+
+TEST(JsonWriterTest, OrderAction) {
+    expectMatchesDump(orderAction());
+}
+
+TEST(JsonWriterTest, CancelAction) {
+    nlohmann::ordered_json action = {
+        {"type", "cancel"},
+        {"cancels", {{{"a", 0}, {"o", 77738308}}, {{"a", 10001}, {"o", 1}}}}
+    };
+    expectMatchesDump(action);
+}
+
+TEST(JsonWriterTest, BatchModifyAction) {
+    nlohmann::ordered_json order = {
+        {"a", 1}, {"b", false}, {"p", "1891.4"}, {"s", "0.0200"}, {"r", true},
+        {"t", {{"trigger", {{"isMarket", true}, {"triggerPx", "1800"}, {"tpsl", "sl"}}}}}
+    };
+    nlohmann::ordered_json action = {
+        {"type", "batchModify"},
+        {"modifies", {{{"oid", 77738308}, {"order", order}}}}
+    };
+    expectMatchesDump(action);
+}
+
+TEST(JsonWriterTest, UsdSendActionWithoutVault) {
+    nlohmann::ordered_json action = {
+        {"type", "usdSend"},
+        {"signatureChainId", "0x66eee"},
+        {"hyperliquidChain", "Mainnet"},
+        {"destination", "0x0000000000000000000000000000000000000001"},
+        {"amount", "12.5"},
+        {"time", NONCE}
+    };
+    expectMatchesDump(action, false);
+}
+
+TEST(JsonWriterTest, ScheduleCancelAction) {
+    expectMatchesDump({{"type", "scheduleCancel"}, {"time", NONCE + 60000}});
+    expectMatchesDump({{"type", "scheduleCancel"}});
+}
+
+TEST(JsonWriterTest, VaultAndExpiresAfter) {
+    expectMatchesDump(orderAction(), true, "0x1111111111111111111111111111111111111111", NONCE + 5000);
+}
+
+TEST(JsonWriterTest, EscapesStrings) {
+    nlohmann::ordered_json action = {
+        {"type", "setDisplayName"},
+        {"displayName", "quote\" back\\slash\ttab\nnewline \x01 ctrl caf\xc3\xa9 /"}
+    };
+    expectMatchesDump(action);
+}
+
+TEST(JsonWriterTest, AppendJsonSortsKeysLikeDump) {
+    nlohmann::ordered_json value = {{"z", 1}, {"a", {{"y", 2.5}, {"b", nullptr}}}, {"m", {1, "two", false}}};
+    std::string out = "prefix:";
+    appendJson(out, value);
+    EXPECT_EQ(out, "prefix:" + nlohmann::json(value).dump());
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,114 @@
+#include "hyperliquid/utils/latency.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+TEST(LatencyHistogramTest, LinearRangeIsExact) {
+    for (int64_t v = 0; v < 128; ++v) {
+        EXPECT_EQ(LatencyHistogram::bucketIndex(v), static_cast<size_t>(v));
+        EXPECT_EQ(LatencyHistogram::bucketValue(static_cast<size_t>(v)), v);
+    }
+}
+
+TEST(LatencyHistogramTest, BucketsRoundDownWithinPrecision) {
+    size_t previous = 0;
+    for (int64_t v = 1; v < LatencyHistogram::MAX_VALUE_NS; v += v / 7 + 1) {
+        size_t index = LatencyHistogram::bucketIndex(v);
+        int64_t lower = LatencyHistogram::bucketValue(index);
+        ASSERT_LT(index, LatencyHistogram::BUCKET_COUNT);
+        ASSERT_GE(index, previous);  // monotonic
+        ASSERT_LE(lower, v);
+        ASSERT_LT(v - lower, std::max<int64_t>(1, v / 64)) << "v=" << v;
+        previous = index;
+    }
+}
+
+TEST(LatencyHistogramTest, BucketValueIsTheInverseOfBucketIndex) {
+    for (size_t i = 0; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+        ASSERT_EQ(LatencyHistogram::bucketIndex(LatencyHistogram::bucketValue(i)), i);
+    }
+}
+
+TEST(LatencyHistogramTest, ClampsOutOfRangeValues) {
+    EXPECT_EQ(LatencyHistogram::bucketIndex(-5), 0u);
+    EXPECT_EQ(LatencyHistogram::bucketIndex(LatencyHistogram::MAX_VALUE_NS), LatencyHistogram::BUCKET_COUNT - 1);
+    EXPECT_EQ(LatencyHistogram::bucketIndex(int64_t{1} << 50), LatencyHistogram::BUCKET_COUNT - 1);
+
+    LatencyHistogram histogram;
+    histogram.record(int64_t{1} << 50);
+    EXPECT_EQ(histogram.max(), LatencyHistogram::MAX_VALUE_NS);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    for (int64_t us = 1; us <= 1000; ++us) {
+        histogram.record(us * 1000);
+    }
+    EXPECT_EQ(histogram.count(), 1000u);
+    EXPECT_EQ(histogram.min(), 1000);
+    EXPECT_EQ(histogram.max(), 1000000);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 500500.0);
+
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.50)), 500000.0, 500000.0 / 64);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.99)), 990000.0, 990000.0 / 64);
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(0.999)), 999000.0, 999000.0 / 64);
+    // Percentiles report their bucket's lower bound, kept within [min, max]
+    EXPECT_EQ(histogram.percentile(0.0), histogram.min());
+    EXPECT_LE(histogram.percentile(1.0), histogram.max());
+    EXPECT_NEAR(static_cast<double>(histogram.percentile(1.0)), 1000000.0, 1000000.0 / 64);
+}
+
+TEST(LatencyHistogramTest, MergeMatchesRecordingEverything) {
+    LatencyHistogram whole;
+    LatencyHistogram low;
+    LatencyHistogram high;
+    for (int64_t v = 100; v < 100000; v += 37) {
+        whole.record(v);
+        (v < 50000 ? low : high).record(v);
+    }
+    low.merge(high);
+    EXPECT_EQ(low.count(), whole.count());
+    EXPECT_EQ(low.min(), whole.min());
+    EXPECT_EQ(low.max(), whole.max());
+    EXPECT_DOUBLE_EQ(low.mean(), whole.mean());
+    for (double q : {0.1, 0.5, 0.9, 0.99}) {
+        EXPECT_EQ(low.percentile(q), whole.percentile(q));
+    }
+}
+
+TEST(LatencyHistogramTest, EmptyHistogram) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.percentile(0.99), 0);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 0.0);
+}
+
+TEST(LatencySnapshotTest, MergesThreadsIncludingFinishedOnes) {
+    resetLatency();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 100; ++i) {
+                recordLatency(LatencyPhase::Ecdsa, 50000);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    recordLatency(LatencyPhase::Keccak, 800);
+
+    LatencySnapshot snapshot = latencySnapshot();
+    EXPECT_EQ(snapshot[LatencyPhase::Ecdsa].count(), 400u);
+    EXPECT_EQ(snapshot[LatencyPhase::Keccak].count(), 1u);
+    EXPECT_EQ(snapshot[LatencyPhase::Msgpack].count(), 0u);
+
+    resetLatency();
+    EXPECT_EQ(latencySnapshot()[LatencyPhase::Ecdsa].count(), 0u);
+}
+
+} // namespace
+} // namespace hyperliquid
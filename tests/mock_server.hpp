@@ -0,0 +1,200 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+namespace test {
+
+/**
+ * Canned reply from a MockServer handler
+ */
+struct MockResponse {
+    int status = 200;
+    std::string body;
+    std::vector<std::pair<std::string, std::string>> headers;
+};
+
+/**
+ * Loopback HTTP/1.1 server for exercising the clients without the network
+ *
+ * Every request is answered by the handler with (path, body). Each
+ * connection gets its own thread, so the handler may run concurrently
+ * and may block to simulate a slow server.
+ */
+class MockServer {
+public:
+    using Handler = std::function<MockResponse(const std::string& path, const std::string& body)>;
+
+    explicit MockServer(Handler handler) : handler_(std::move(handler)) {
+        listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        int reuse = 1;
+        ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        addr.sin_port = 0;
+        socklen_t len = sizeof(addr);
+        if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(listen_fd_, 64) != 0 ||
+            ::getsockname(listen_fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+            ::close(listen_fd_);
+            throw std::runtime_error("MockServer: cannot listen on loopback");
+        }
+        port_ = ntohs(addr.sin_port);
+        acceptor_ = std::thread(&MockServer::acceptLoop, this);
+    }
+
+    ~MockServer() {
+        stopping_ = true;
+        ::shutdown(listen_fd_, SHUT_RDWR);
+        acceptor_.join();
+        ::close(listen_fd_);
+
+        std::vector<std::thread> connections;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (int fd : connection_fds_) {
+                ::shutdown(fd, SHUT_RDWR);
+            }
+            connections.swap(connections_);
+        }
+        for (auto& connection : connections) {
+            connection.join();
+        }
+    }
+
+    MockServer(const MockServer&) = delete;
+    MockServer& operator=(const MockServer&) = delete;
+
+    std::string url() const {
+        return "http://127.0.0.1:" + std::to_string(port_);
+    }
+
+    /**
+     * Requests answered so far
+     */
+    size_t requestCount() const {
+        return requests_.load();
+    }
+
+private:
+    void acceptLoop() {
+        while (!stopping_) {
+            int fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            connection_fds_.push_back(fd);
+            connections_.emplace_back(&MockServer::serve, this, fd);
+        }
+    }
+
+    static std::string lowercase(std::string s) {
+        std::transform(s.begin(), s.end(), s.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return s;
+    }
+
+    static bool sendAll(int fd, const std::string& data) {
+        size_t sent = 0;
+        while (sent < data.size()) {
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                return false;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    void serve(int fd) {
+        serveRequests(fd);
+        std::lock_guard<std::mutex> lock(mutex_);
+        connection_fds_.erase(std::find(connection_fds_.begin(), connection_fds_.end(), fd));
+        ::close(fd);
+    }
+
+    // Keep-alive loop: one request/response exchange per iteration
+    void serveRequests(int fd) {
+        std::string buffer;
+        char chunk[4096];
+        while (true) {
+            size_t header_end;
+            while ((header_end = buffer.find("\r\n\r\n")) == std::string::npos) {
+                ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, static_cast<size_t>(n));
+            }
+
+            std::string head = lowercase(buffer.substr(0, header_end));
+            size_t path_start = buffer.find(' ') + 1;
+            std::string path = buffer.substr(path_start, buffer.find(' ', path_start) - path_start);
+
+            size_t content_length = 0;
+            size_t length_pos = head.find("content-length:");
+            if (length_pos != std::string::npos) {
+                content_length = std::stoul(head.substr(length_pos + 15));
+            }
+            if (head.find("expect: 100-continue") != std::string::npos &&
+                !sendAll(fd, "HTTP/1.1 100 Continue\r\n\r\n")) {
+                return;
+            }
+
+            buffer.erase(0, header_end + 4);
+            while (buffer.size() < content_length) {
+                ssize_t n = ::recv(fd, chunk, sizeof(chunk), 0);
+                if (n <= 0) {
+                    return;
+                }
+                buffer.append(chunk, static_cast<size_t>(n));
+            }
+            std::string body = buffer.substr(0, content_length);
+            buffer.erase(0, content_length);
+
+            MockResponse response = handler_(path, body);
+            ++requests_;
+
+            std::string reply = "HTTP/1.1 " + std::to_string(response.status) + " Mock\r\n"
+                                "Content-Type: application/json\r\n"
+                                "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+            for (const auto& header : response.headers) {
+                reply += header.first + ": " + header.second + "\r\n";
+            }
+            reply += "\r\n" + response.body;
+            if (!sendAll(fd, reply)) {
+                return;
+            }
+        }
+    }
+
+    Handler handler_;
+    int listen_fd_ = -1;
+    int port_ = 0;
+    std::atomic<bool> stopping_{false};
+    std::atomic<size_t> requests_{0};
+
+    std::mutex mutex_;
+    std::vector<int> connection_fds_;
+    std::vector<std::thread> connections_;
+    std::thread acceptor_;
+};
+
+} // namespace test
+} // namespace hyperliquid
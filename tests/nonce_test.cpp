@@ -0,0 +1,64 @@
+#include "hyperliquid/utils/nonce.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+TEST(NonceManagerTest, IsStrictlyIncreasingWithinAThread) {
+    NonceManager nonces;
+    EXPECT_EQ(nonces.last(), 0);
+
+    int64_t previous = nonces.next();
+    for (int i = 0; i < 10000; ++i) {
+        int64_t current = nonces.next();
+        ASSERT_GT(current, previous);
+        previous = current;
+    }
+    EXPECT_EQ(nonces.last(), previous);
+}
+
+TEST(NonceManagerTest, NeverHandsOutTheSameNonceAcrossThreads) {
+    constexpr int THREADS = 8;
+    constexpr int PER_THREAD = 5000;
+
+    NonceManager nonces;
+    std::vector<std::vector<int64_t>> drawn(THREADS);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&nonces, &drawn, t]() {
+            drawn[t].reserve(PER_THREAD);
+            for (int i = 0; i < PER_THREAD; ++i) {
+                drawn[t].push_back(nonces.next());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<int64_t> all;
+    for (const auto& sequence : drawn) {
+        // Each thread observes a strictly increasing sequence
+        EXPECT_TRUE(std::adjacent_find(sequence.begin(), sequence.end(),
+                                       [](int64_t a, int64_t b) { return a >= b; }) == sequence.end());
+        all.insert(all.end(), sequence.begin(), sequence.end());
+    }
+
+    std::sort(all.begin(), all.end());
+    EXPECT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+    EXPECT_EQ(nonces.last(), all.back());
+}
+
+TEST(NonceManagerTest, SharesOneManagerPerAddress) {
+    auto first = NonceManager::forAddress("0x00000000000000000000000000000000000000aa");
+    auto second = NonceManager::forAddress("0x00000000000000000000000000000000000000AA");
+    auto other = NonceManager::forAddress("0x00000000000000000000000000000000000000bb");
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,168 @@
+#include "hyperliquid/exchange.hpp"
+#include "hyperliquid/order_batcher.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+const char* TEST_KEY = "0x0123456789012345678901234567890123456789012345678901234567890123";
+
+// Answers /exchange like the venue: orders rest with oids 1, 2, ...; cancels succeed.
+// Records (action type, item count) in arrival order.
+class BatcherServer {
+public:
+    BatcherServer() : server_([this](const std::string&, const std::string& body) { return handle(body); }) {}
+
+    std::string url() const { return server_.url(); }
+
+    std::vector<std::pair<std::string, size_t>> actions() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return actions_;
+    }
+
+    void rejectNext() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        reject_next_ = true;
+    }
+
+private:
+    test::MockResponse handle(const std::string& body) {
+        nlohmann::json action = nlohmann::json::parse(body)["action"];
+        std::string type = action["type"];
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (reject_next_) {
+            reject_next_ = false;
+            return {200, R"({"status":"err","response":"Insufficient margin"})", {}};
+        }
+
+        nlohmann::json statuses = nlohmann::json::array();
+        size_t count = type == "order" ? action["orders"].size()
+                     : type == "batchModify" ? action["modifies"].size()
+                     : action["cancels"].size();
+        for (size_t i = 0; i < count; ++i) {
+            if (type == "cancel" || type == "cancelByCloid") {
+                statuses.push_back("success");
+            } else {
+                statuses.push_back({{"resting", {{"oid", ++next_oid_}}}});
+            }
+        }
+        actions_.emplace_back(type, count);
+
+        nlohmann::json response = {
+            {"status", "ok"},
+            {"response", {{"type", type}, {"data", {{"statuses", statuses}}}}}
+        };
+        return {200, response.dump(), {}};
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<std::pair<std::string, size_t>> actions_;
+    int64_t next_oid_ = 0;
+    bool reject_next_ = false;
+    test::MockServer server_;  // last: stops before the state it uses
+};
+
+class OrderBatcherTest : public ::testing::Test {
+protected:
+    OrderBatcherTest()
+        : exchange_(Wallet::fromPrivateKey(TEST_KEY), server_.url(), &meta_, "", "", &spot_meta_) {
+        exchange_.setRateLimiter(nullptr);
+    }
+
+    static Meta makeMeta() {
+        Meta meta;
+        meta.universe = {{"BTC", 5}, {"ETH", 4}};
+        return meta;
+    }
+
+    static OrderRequest limitOrder(double px) {
+        OrderType type;
+        type.limit = LimitOrderType{"Gtc"};
+        return OrderRequest{"BTC", true, 0.01, px, type, false, std::nullopt};
+    }
+
+    static int64_t restingOid(std::future<OrderStatus>& future) {
+        OrderStatus status = future.get();
+        const auto* resting = std::get_if<RestingStatus>(&status);
+        return resting != nullptr ? resting->oid : -1;
+    }
+
+    BatcherServer server_;
+    Meta meta_ = makeMeta();
+    SpotMeta spot_meta_;
+    Exchange exchange_;
+};
+
+TEST_F(OrderBatcherTest, CoalescesSubmissionsAndResolvesEachFuture) {
+    OrderBatcher batcher(exchange_, std::chrono::seconds(5));
+    auto first = batcher.submitOrder(limitOrder(50000.0));
+    auto second = batcher.submitOrder(limitOrder(49000.0));
+    auto third = batcher.submitOrder(limitOrder(48000.0));
+    batcher.flush();
+
+    EXPECT_EQ(restingOid(first), 1);
+    EXPECT_EQ(restingOid(second), 2);
+    EXPECT_EQ(restingOid(third), 3);
+
+    auto actions = server_.actions();
+    ASSERT_EQ(actions.size(), 1u);
+    EXPECT_EQ(actions[0], std::make_pair(std::string("order"), size_t{3}));
+}
+
+TEST_F(OrderBatcherTest, KeepsSubmissionOrderAcrossKinds) {
+    OrderBatcher batcher(exchange_, std::chrono::seconds(5));
+    auto order = batcher.submitOrder(limitOrder(50000.0));
+    auto cancel = batcher.submitCancel(CancelRequest{"BTC", 1});
+    auto replacement = batcher.submitOrder(limitOrder(49000.0));
+    batcher.flush();
+
+    EXPECT_EQ(restingOid(order), 1);
+    OrderStatus cancel_status = cancel.get();
+    ASSERT_TRUE(std::holds_alternative<AckStatus>(cancel_status));
+    EXPECT_EQ(std::get<AckStatus>(cancel_status).status, "success");
+    EXPECT_EQ(restingOid(replacement), 2);
+
+    auto actions = server_.actions();
+    ASSERT_EQ(actions.size(), 3u);
+    EXPECT_EQ(actions[0].first, "order");
+    EXPECT_EQ(actions[1].first, "cancel");
+    EXPECT_EQ(actions[2].first, "order");
+}
+
+TEST_F(OrderBatcherTest, SplitsActionsAtMaxBatch) {
+    OrderBatcher batcher(exchange_, std::chrono::seconds(5), 2);
+    std::vector<std::future<OrderStatus>> futures;
+    for (int i = 0; i < 5; ++i) {
+        futures.push_back(batcher.submitOrder(limitOrder(50000.0 - i)));
+    }
+    batcher.flush();
+    for (auto& future : futures) {
+        future.wait();
+    }
+
+    auto actions = server_.actions();
+    ASSERT_EQ(actions.size(), 3u);
+    EXPECT_EQ(actions[0].second, 2u);
+    EXPECT_EQ(actions[1].second, 2u);
+    EXPECT_EQ(actions[2].second, 1u);
+}
+
+TEST_F(OrderBatcherTest, RejectedActionFailsEveryFutureInTheBatch) {
+    server_.rejectNext();
+    OrderBatcher batcher(exchange_, std::chrono::seconds(5));
+    auto first = batcher.submitOrder(limitOrder(50000.0));
+    auto second = batcher.submitOrder(limitOrder(49000.0));
+    batcher.flush();
+
+    EXPECT_THROW(first.get(), std::runtime_error);
+    EXPECT_THROW(second.get(), std::runtime_error);
+}
+
+} // namespace
+} // namespace hyperliquid
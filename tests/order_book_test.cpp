@@ -0,0 +1,116 @@
+#include "hyperliquid/order_book.hpp"
+#include <gtest/gtest.h>
+
+namespace hyperliquid {
+namespace {
+
+nlohmann::json l2Book() {
+    return nlohmann::json::parse(R"({
+        "coin": "BTC",
+        "time": 1708622398623,
+        "levels": [
+            [{"px": "100.5", "sz": "1.0", "n": 1}, {"px": "100.0", "sz": "2.0", "n": 2}, {"px": "99.0", "sz": "3.0", "n": 3}],
+            [{"px": "101.0", "sz": "1.5", "n": 1}, {"px": "101.5", "sz": "2.5", "n": 2}, {"px": "103.0", "sz": "4.0", "n": 4}]
+        ]
+    })");
+}
+
+std::vector<double> prices(const std::vector<BookLevel>& levels) {
+    std::vector<double> result;
+    for (const auto& level : levels) {
+        result.push_back(level.px);
+    }
+    return result;
+}
+
+TEST(OrderBookTest, SnapshotOrdersBothSidesBestFirst) {
+    OrderBook book("BTC");
+    book.applySnapshot(l2Book());
+
+    EXPECT_EQ(book.time(), 1708622398623);
+    EXPECT_EQ(book.bestBid(), 100.5);
+    EXPECT_EQ(book.bestAsk(), 101.0);
+    EXPECT_EQ(book.mid(), 100.75);
+    EXPECT_EQ(prices(book.depth(true, 10)), (std::vector<double>{100.5, 100.0, 99.0}));
+    EXPECT_EQ(prices(book.depth(false, 2)), (std::vector<double>{101.0, 101.5}));
+}
+
+TEST(OrderBookTest, StreamMessageWrapperIsAccepted) {
+    OrderBook book("BTC");
+    book.applySnapshot({{"channel", "l2Book"}, {"data", l2Book()}});
+    EXPECT_EQ(book.bestBid(), 100.5);
+    EXPECT_EQ(book.bestAsk(), 101.0);
+}
+
+TEST(OrderBookTest, UpdateLevelInsertsKeepingOrder) {
+    OrderBook book("BTC");
+    book.applySnapshot(l2Book());
+
+    book.updateLevel(true, 99.5, 1.0);    // between existing bids
+    book.updateLevel(true, 100.75, 0.5);  // new best bid
+    book.updateLevel(false, 102.0, 1.0);  // between existing asks
+    book.updateLevel(false, 100.9, 0.25); // new best ask
+
+    EXPECT_EQ(prices(book.depth(true, 10)), (std::vector<double>{100.75, 100.5, 100.0, 99.5, 99.0}));
+    EXPECT_EQ(prices(book.depth(false, 10)), (std::vector<double>{100.9, 101.0, 101.5, 102.0, 103.0}));
+    EXPECT_EQ(book.bestBid(), 100.75);
+    EXPECT_EQ(book.bestAsk(), 100.9);
+}
+
+TEST(OrderBookTest, UpdateLevelReplacesSizeInPlace) {
+    OrderBook book("BTC");
+    book.applySnapshot(l2Book());
+
+    book.updateLevel(true, 100.0, 7.0, 5);
+
+    auto bids = book.depth(true, 10);
+    ASSERT_EQ(bids.size(), 3u);
+    EXPECT_EQ(bids[1].px, 100.0);
+    EXPECT_EQ(bids[1].sz, 7.0);
+    EXPECT_EQ(bids[1].n, 5);
+}
+
+TEST(OrderBookTest, ZeroSizeRemovesLevel) {
+    OrderBook book("BTC");
+    book.applySnapshot(l2Book());
+
+    book.updateLevel(true, 100.5, 0.0);   // best bid
+    book.updateLevel(false, 101.5, 0.0);  // inner ask
+    book.updateLevel(false, 200.0, 0.0);  // absent level is a no-op
+
+    EXPECT_EQ(prices(book.depth(true, 10)), (std::vector<double>{100.0, 99.0}));
+    EXPECT_EQ(prices(book.depth(false, 10)), (std::vector<double>{101.0, 103.0}));
+    EXPECT_EQ(book.bestBid(), 100.0);
+}
+
+TEST(OrderBookTest, EmptySideHasNoMid) {
+    OrderBook book("BTC");
+    EXPECT_TRUE(book.empty());
+    book.updateLevel(true, 100.0, 1.0);
+    EXPECT_EQ(book.bestBid(), 100.0);
+    EXPECT_FALSE(book.bestAsk().has_value());
+    EXPECT_FALSE(book.mid().has_value());
+
+    book.clear();
+    EXPECT_TRUE(book.empty());
+}
+
+TEST(OrderBookTest, VwapAndFillPriceWalkTheBook) {
+    OrderBook book("BTC");
+    book.applySnapshot(l2Book());
+
+    // Buy 3: 1.5 @ 101.0 + 1.5 @ 101.5
+    EXPECT_DOUBLE_EQ(book.vwap(true, 3.0).value(), 101.25);
+    EXPECT_EQ(book.fillPrice(true, 3.0), 101.5);
+
+    // Sell 2: 1.0 @ 100.5 + 1.0 @ 100.0
+    EXPECT_DOUBLE_EQ(book.vwap(false, 2.0).value(), 100.25);
+    EXPECT_EQ(book.fillPrice(false, 2.0), 100.0);
+
+    EXPECT_DOUBLE_EQ(book.depthSize(false, 2), 4.0);
+    EXPECT_FALSE(book.vwap(true, 100.0).has_value());
+    EXPECT_FALSE(book.fillPrice(false, 100.0).has_value());
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,82 @@
+#include "hyperliquid/info.hpp"
+#include "hyperliquid/order_manager.hpp"
+#include "fixtures.hpp"
+#include <gtest/gtest.h>
+
+namespace hyperliquid {
+namespace {
+
+class OrderManagerTest : public ::testing::Test {
+protected:
+    OrderManagerTest() : info_(test::unreachableUrl(), true, &meta_, &spot_meta_) {}
+
+    static Meta makeMeta() {
+        Meta meta;
+        meta.universe = {{"BTC", 5}, {"ETH", 4}};
+        return meta;
+    }
+
+    static SpotMeta makeSpotMeta() {
+        SpotMeta spot_meta;
+        spot_meta.tokens = {{"USDC", 8, 8, 0, "0x0", true}, {"PURR", 0, 5, 1, "0x1", true}};
+        spot_meta.universe = {{"@1", {1, 0}, 1, true}};
+        return spot_meta;
+    }
+
+    static OrderRequest limitOrder(const std::string& coin, double px) {
+        OrderType type;
+        type.limit = LimitOrderType{"Gtc"};
+        return OrderRequest{coin, true, 1.0, px, type, false, std::nullopt};
+    }
+
+    static ActionResponse restingAck(int64_t oid) {
+        ActionResponse ack;
+        ack.ok = true;
+        ack.type = "order";
+        ack.statuses.push_back(RestingStatus{oid, std::nullopt});
+        return ack;
+    }
+
+    Meta meta_ = makeMeta();
+    SpotMeta spot_meta_ = makeSpotMeta();
+    Info info_;
+};
+
+TEST_F(OrderManagerTest, TracksOrdersUnderTheWireCoin) {
+    OrderManager manager;
+    manager.onOrderResponse({limitOrder("PURR/USDC", 0.2)}, {10001}, restingAck(11), info_);
+
+    auto tracked = manager.findByOid(11);
+    ASSERT_TRUE(tracked.has_value());
+    EXPECT_EQ(tracked->coin, "@1");  // same key as openOrders / orderUpdates
+    EXPECT_EQ(tracked->asset, 10001);
+}
+
+TEST_F(OrderManagerTest, CancelDropsOrdersThatAreNoLongerOpen) {
+    OrderManager manager;
+    manager.onOrderResponse({limitOrder("BTC", 50000.0)}, {0}, restingAck(1), info_);
+    manager.onOrderResponse({limitOrder("BTC", 49000.0)}, {0}, restingAck(2), info_);
+    ASSERT_EQ(manager.openCount(), 2u);
+
+    ActionResponse ack;
+    parseActionResponse(test::readFixture("exchange_cancel.json"), ack);
+    manager.onCancelResponse({int64_t{1}, int64_t{2}}, ack);
+
+    EXPECT_EQ(manager.openCount(), 0u);
+}
+
+TEST_F(OrderManagerTest, CancelKeepsOrdersOnOtherErrors) {
+    OrderManager manager;
+    manager.onOrderResponse({limitOrder("BTC", 50000.0)}, {0}, restingAck(1), info_);
+
+    ActionResponse ack;
+    ack.ok = true;
+    ack.type = "cancel";
+    ack.statuses.push_back(ErrorStatus{"Too many cumulative requests sent. already canceled orders count"});
+    manager.onCancelResponse({int64_t{1}}, ack);
+
+    EXPECT_TRUE(manager.findByOid(1).has_value());
+}
+
+} // namespace
+} // namespace hyperliquid
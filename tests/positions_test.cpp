@@ -0,0 +1,88 @@
+#include "hyperliquid/exchange_router.hpp"
+#include "hyperliquid/info.hpp"
+#include "hyperliquid/positions.hpp"
+#include "fixtures.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+
+namespace hyperliquid {
+namespace {
+
+class PositionTrackerTest : public ::testing::Test {
+protected:
+    PositionTrackerTest() : info_(test::unreachableUrl(), true, &meta_, &spot_meta_) {}
+
+    static Meta makeMeta() {
+        Meta meta;
+        meta.universe = {{"BTC", 5}, {"ETH", 4}};
+        return meta;
+    }
+
+    Meta meta_ = makeMeta();
+    SpotMeta spot_meta_;
+    Info info_;
+};
+
+TEST_F(PositionTrackerTest, SeededTrackerIsNotFedUntilSomethingFeedsIt) {
+    PositionTracker tracker;
+    tracker.seed(nlohmann::json::parse(test::readFixture("clearinghouse_state.json")), info_);
+
+    EXPECT_TRUE(tracker.isSeeded());
+    EXPECT_FALSE(tracker.isFed());
+    ASSERT_TRUE(tracker.position(1).has_value());
+    EXPECT_DOUBLE_EQ(tracker.position(1)->szi, -0.0012);
+}
+
+TEST_F(PositionTrackerTest, OrderAckTrackingFeedsTheTracker) {
+    PositionTracker tracker;
+    tracker.setTrackOrderAcks(true);
+    EXPECT_FALSE(tracker.isFed());  // not seeded yet
+
+    tracker.seed(nlohmann::json::parse(test::readFixture("clearinghouse_state.json")), info_);
+    EXPECT_TRUE(tracker.isFed());
+}
+
+TEST_F(PositionTrackerTest, FillsSubscriptionFeedsTheTracker) {
+    PositionTracker tracker;
+    tracker.seed(nlohmann::json::parse(test::readFixture("clearinghouse_state.json")), info_);
+
+    // The subscription's first message is a snapshot; it attaches the feed without applying
+    tracker.applyFills(nlohmann::json::parse(R"({"channel":"userFills","data":{"isSnapshot":true,"fills":[]}})"), info_);
+    EXPECT_TRUE(tracker.isFed());
+    EXPECT_DOUBLE_EQ(tracker.position(0)->szi, 0.5);
+
+    tracker.applyFills(nlohmann::json::parse(
+        R"({"channel":"userFills","data":{"fills":[{"coin":"BTC","side":"A","sz":"0.2","px":"51000.0"}]}})"), info_);
+    EXPECT_DOUBLE_EQ(tracker.position(0)->szi, 0.3);
+
+    tracker.clear();
+    EXPECT_FALSE(tracker.isFed());
+}
+
+TEST_F(PositionTrackerTest, OrderAcksForOtherVaultsAreNotTracked) {
+    // Every order fills 0.1 at 50000
+    test::MockServer server([](const std::string&, const std::string&) {
+        return test::MockResponse{200, R"({"status":"ok","response":{"type":"order","data":{"statuses":[)"
+                                       R"({"filled":{"totalSz":"0.1","avgPx":"50000.0","oid":1}}]}}})", {}};
+    });
+    Exchange exchange(Wallet::fromPrivateKey("0x0123456789012345678901234567890123456789012345678901234567890123"),
+                      server.url(), &meta_, "", "", &spot_meta_);
+    exchange.setRateLimiter(nullptr);
+    exchange.positions_.seed(nlohmann::json::parse(test::readFixture("clearinghouse_state.json")), info_);
+    exchange.positions_.setTrackOrderAcks(true);
+
+    OrderType type;
+    type.limit = LimitOrderType{"Ioc"};
+    std::vector<OrderRequest> orders = {OrderRequest{"BTC", true, 0.1, 51000.0, type, false, std::nullopt}};
+    ActionResponse result;
+
+    ExchangeRouter router(exchange);
+    router.bulkOrders("0x000000000000000000000000000000000000000a", orders, result);
+    EXPECT_DOUBLE_EQ(exchange.positions_.position(0)->szi, 0.5);
+
+    exchange.bulkOrders(orders, result);
+    EXPECT_DOUBLE_EQ(exchange.positions_.position(0)->szi, 0.6);
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,50 @@
+#include "hyperliquid/quote_slot.hpp"
+#include "hyperliquid/utils/signing.hpp"
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+const Cloid SLOT_CLOID("0x00000000000000000000000000000abc");
+
+void expectPatchedMatchesEncoded(QuoteSlot& slot, const std::vector<std::pair<double, double>>& quotes) {
+    for (const auto& quote : quotes) {
+        slot.update(quote.first, quote.second);
+        SCOPED_TRACE("px=" + slot.action()["modifies"][0]["order"]["p"].get<std::string>() +
+                     " sz=" + slot.action()["modifies"][0]["order"]["s"].get<std::string>());
+        EXPECT_EQ(slot.packedAction(), packAction(slot.action()));
+    }
+}
+
+TEST(QuoteSlotTest, PatchedActionMatchesFullEncodingAcrossDigitCounts) {
+    QuoteSlot slot(0, "BTC", true, "Alo", SLOT_CLOID, 5);
+    expectPatchedMatchesEncoded(slot, {
+        {9.5, 0.001},
+        {10.25, 0.01},        // price gains an integer digit
+        {99999.0, 1.0},
+        {100001.0, 12.34567}, // past the 5 significant figure limit
+        {7.0, 250.0},         // and shrinks back
+        {0.5, 0.00001},
+    });
+}
+
+TEST(QuoteSlotTest, PatchedActionMatchesForSpotAndReduceOnly) {
+    QuoteSlot spot(10001, "@1", false, "Gtc", SLOT_CLOID, 0);
+    expectPatchedMatchesEncoded(spot, {{0.1234567, 10.0}, {1.5, 12345.0}, {0.00012345, 3.0}});
+
+    QuoteSlot reduce(1, "ETH", false, "Ioc", SLOT_CLOID, 4, true);
+    expectPatchedMatchesEncoded(reduce, {{1891.4, 0.02}, {2000.05, 1.2345}});
+}
+
+TEST(QuoteSlotTest, UpdateRoundsToTickAndLot) {
+    QuoteSlot slot(0, "BTC", true, "Alo", SLOT_CLOID, 5);
+    slot.update(50000.123, 0.0123456);
+    EXPECT_EQ(slot.action()["modifies"][0]["order"]["p"], "50000");
+    EXPECT_EQ(slot.action()["modifies"][0]["order"]["s"], "0.01235");
+    EXPECT_EQ(slot.action()["modifies"][0]["oid"], SLOT_CLOID.toRaw());
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,145 @@
+#include "hyperliquid/rate_limiter.hpp"
+#include "hyperliquid/errors.hpp"
+#include "hyperliquid/info.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace hyperliquid {
+namespace {
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+// Refills at `per_ms` weight per millisecond on top of a 100 weight burst
+RateLimitConfig config(double per_ms, double reserve) {
+    RateLimitConfig cfg;
+    cfg.burst = 100.0;
+    cfg.weight_per_minute = cfg.burst + per_ms * 60000.0;
+    cfg.priority_reserve = reserve;
+    cfg.min_backoff = 100ms;
+    cfg.max_backoff = 1000ms;
+    return cfg;
+}
+
+TEST(RateLimiterTest, RejectsInvalidConfig) {
+    RateLimitConfig cfg;
+    cfg.weight_per_minute = cfg.burst;
+    EXPECT_THROW(RateLimiter{cfg}, std::invalid_argument);
+
+    cfg = RateLimitConfig();
+    cfg.priority_reserve = cfg.burst;
+    EXPECT_THROW(RateLimiter{cfg}, std::invalid_argument);
+}
+
+TEST(RateLimiterTest, NormalLaneLeavesThePriorityReserve) {
+    RateLimiter limiter(config(0.1, 20.0));
+    EXPECT_TRUE(limiter.tryAcquire(60.0));
+    EXPECT_FALSE(limiter.tryAcquire(30.0));                    // would dip into the reserve
+    EXPECT_TRUE(limiter.tryAcquire(30.0, RateLane::Priority));  // may use it
+    EXPECT_FALSE(limiter.tryAcquire(30.0, RateLane::Priority));
+}
+
+TEST(RateLimiterTest, RefillsOverTime) {
+    RateLimiter limiter(config(0.1, 0.0));
+    EXPECT_TRUE(limiter.tryAcquire(100.0));
+    EXPECT_LT(limiter.available(), 5.0);
+
+    std::this_thread::sleep_for(300ms);
+    double available = limiter.available();
+    EXPECT_GE(available, 29.0);
+    EXPECT_LE(available, 100.0);
+    EXPECT_TRUE(limiter.tryAcquire(25.0));
+}
+
+TEST(RateLimiterTest, AcquireBlocksUntilWeightRefills) {
+    RateLimiter limiter(config(1.0, 0.0));
+    ASSERT_TRUE(limiter.tryAcquire(100.0));
+
+    auto start = Clock::now();
+    limiter.acquire(50.0);
+    auto waited = Clock::now() - start;
+    EXPECT_GE(waited, 45ms);
+    EXPECT_LT(waited, 1000ms);
+}
+
+TEST(RateLimiterTest, WaitingPriorityRequestsGoFirst) {
+    RateLimiter limiter(config(0.1, 0.0));
+    ASSERT_TRUE(limiter.tryAcquire(100.0, RateLane::Priority));
+
+    std::atomic<bool> done{false};
+    std::thread cancel([&]() {
+        limiter.acquire(50.0, RateLane::Priority);  // ~500 ms of refill
+        done = true;
+    });
+
+    std::this_thread::sleep_for(150ms);
+    EXPECT_GE(limiter.available(), 10.0);
+    EXPECT_FALSE(limiter.tryAcquire(5.0));  // enough weight, but a cancel is waiting
+    cancel.join();
+    EXPECT_TRUE(done);
+}
+
+TEST(RateLimiterTest, BacksOffAfterRateLimit) {
+    RateLimiter limiter(config(1.0, 0.0));
+    limiter.onRateLimited(200ms);
+    EXPECT_DOUBLE_EQ(limiter.available(), 0.0);
+    EXPECT_FALSE(limiter.tryAcquire(1.0, RateLane::Priority));
+
+    std::this_thread::sleep_for(300ms);
+    EXPECT_TRUE(limiter.tryAcquire(10.0));  // refilling from empty after the pause
+}
+
+TEST(RateLimiterTest, BackoffDoublesUntilSuccess) {
+    RateLimiter limiter(config(1.0, 0.0));
+    limiter.onRateLimited();  // 100 ms
+    limiter.onRateLimited();  // 200 ms
+    std::this_thread::sleep_for(150ms);
+    EXPECT_DOUBLE_EQ(limiter.available(), 0.0);
+
+    std::this_thread::sleep_for(100ms);
+    limiter.onSuccess();
+    limiter.onRateLimited();  // back to 100 ms
+    std::this_thread::sleep_for(150ms);
+    EXPECT_GT(limiter.available(), 0.0);
+}
+
+TEST(RateLimiterTest, ClientHonoursRetryAfter) {
+    test::MockServer server([](const std::string&, const std::string&) {
+        return test::MockResponse{429, "{}", {{"Retry-After", "1"}}};
+    });
+    Meta meta;
+    SpotMeta spot_meta;
+    Info info(server.url(), true, &meta, &spot_meta);
+    auto limiter = std::make_shared<RateLimiter>(config(1.0, 0.0));
+    info.setRateLimiter(limiter);
+
+    EXPECT_THROW(info.allMids(), RateLimitError);
+    EXPECT_EQ(server.requestCount(), 1u);  // a 429 is not retried
+    std::this_thread::sleep_for(500ms);
+    EXPECT_DOUBLE_EQ(limiter->available(), 0.0);  // Retry-After beats the 100 ms minimum
+}
+
+TEST(RateLimiterTest, RequestWeights) {
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/exchange", "order", 1), 1.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/exchange", "order", 39), 1.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/exchange", "order", 40), 2.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/exchange", "cancel", 85), 3.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/info", "l2Book"), 2.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/info", "clearinghouseState"), 2.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/info", "userRole"), 60.0);
+    EXPECT_DOUBLE_EQ(RateLimiter::requestWeight("/info", "userFills"), 20.0);
+
+    EXPECT_EQ(RateLimiter::laneFor("cancel"), RateLane::Priority);
+    EXPECT_EQ(RateLimiter::laneFor("cancelByCloid"), RateLane::Priority);
+    EXPECT_EQ(RateLimiter::laneFor("scheduleCancel"), RateLane::Priority);
+    EXPECT_EQ(RateLimiter::laneFor("order"), RateLane::Normal);
+}
+
+} // namespace
+} // namespace hyperliquid
@@ -0,0 +1,208 @@
+#include "hyperliquid/errors.hpp"
+#include "hyperliquid/info.hpp"
+#include "mock_server.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hyperliquid {
+namespace {
+
+using namespace std::chrono_literals;
+using Clock = std::chrono::steady_clock;
+
+const std::string USER = "0x0000000000000000000000000000000000000001";
+
+std::string fillsReply(int64_t time) {
+    nlohmann::json fill = {
+        {"coin", "BTC"}, {"px", "50000.0"}, {"sz", "0.01"}, {"side", "B"},
+        {"time", time}, {"startPosition", "0.0"}, {"dir", "Open Long"},
+        {"closedPnl", "0.0"}, {"hash", "0x" + std::string(64, '1')},
+        {"oid", 1}, {"crossed", true}, {"fee", "0.1"}, {"tid", time}, {"feeToken", "USDC"}
+    };
+    return nlohmann::json::array({fill}).dump();
+}
+
+class RetryTest : public ::testing::Test {
+protected:
+    RetryTest() {
+        meta_.universe = {{"BTC", 5}, {"ETH", 4}};
+        policy_.base_backoff = 10ms;
+        policy_.hedge_default_delay = 50ms;
+    }
+
+    std::unique_ptr<Info> client(const test::MockServer& server, int timeout_ms = 30000) {
+        auto info = std::make_unique<Info>(server.url(), true, &meta_, &spot_meta_, nullptr, timeout_ms);
+        info->setRateLimiter(nullptr);
+        info->setRetryPolicy(policy_);
+        return info;
+    }
+
+    static TransferSummary summary(const Info& info, const std::string& type) {
+        for (const auto& entry : info.transferStats()->snapshot()) {
+            if (entry.endpoint == "/info" && entry.type == type) {
+                return entry;
+            }
+        }
+        return TransferSummary();
+    }
+
+    Meta meta_;
+    SpotMeta spot_meta_;
+    RetryPolicy policy_;
+};
+
+TEST_F(RetryTest, RetriesServerErrors) {
+    std::atomic<int> requests{0};
+    test::MockServer server([&](const std::string&, const std::string&) {
+        if (requests++ == 0) {
+            return test::MockResponse{502, "{}", {}};
+        }
+        return test::MockResponse{200, R"({"BTC":"50000.0"})", {}};
+    });
+    auto info = client(server);
+
+    EXPECT_EQ(info->allMids()["BTC"], "50000.0");
+    EXPECT_EQ(requests, 2);
+    EXPECT_EQ(summary(*info, "allMids").retries, 1u);
+}
+
+TEST_F(RetryTest, DoesNotRetryClientErrors) {
+    std::atomic<int> requests{0};
+    test::MockServer server([&](const std::string&, const std::string&) {
+        ++requests;
+        return test::MockResponse{400, "{}", {}};
+    });
+    auto info = client(server);
+
+    EXPECT_THROW(info->allMids(), ClientError);
+    EXPECT_EQ(requests, 1);
+}
+
+TEST_F(RetryTest, GivesUpAfterMaxAttempts) {
+    std::atomic<int> requests{0};
+    test::MockServer server([&](const std::string&, const std::string&) {
+        ++requests;
+        return test::MockResponse{503, "{}", {}};
+    });
+    auto info = client(server);
+
+    EXPECT_THROW(info->allMids(), ServerError);
+    EXPECT_EQ(requests, policy_.max_attempts);
+}
+
+TEST_F(RetryTest, ClientTimeoutBoundsAllAttempts) {
+    test::MockServer server([](const std::string&, const std::string&) {
+        std::this_thread::sleep_for(400ms);
+        return test::MockResponse{200, "{}", {}};
+    });
+    policy_.max_attempts = 10;
+    policy_.attempt_timeout_ms = 150;
+    auto info = client(server, 500);
+
+    auto start = Clock::now();
+    EXPECT_THROW(info->allMids(), NetworkError);
+    EXPECT_LT(Clock::now() - start, 800ms);
+    EXPECT_GE(summary(*info, "allMids").retries, 1u);
+}
+
+TEST_F(RetryTest, HedgesSlowQueries) {
+    std::atomic<int> requests{0};
+    test::MockServer server([&](const std::string&, const std::string&) {
+        if (requests++ == 0) {
+            std::this_thread::sleep_for(600ms);
+        }
+        return test::MockResponse{200, R"({"BTC":"50000.0"})", {}};
+    });
+    policy_.hedge = true;
+    auto info = client(server);
+
+    auto start = Clock::now();
+    EXPECT_EQ(info->allMids()["BTC"], "50000.0");
+    EXPECT_LT(Clock::now() - start, 400ms);
+    TransferSummary stats = summary(*info, "allMids");
+    EXPECT_EQ(stats.hedges, 1u);
+    EXPECT_EQ(stats.hedge_wins, 1u);
+}
+
+TEST_F(RetryTest, RetriesStreamsBeforeTheBodyStarts) {
+    std::atomic<int> requests{0};
+    test::MockServer server([&](const std::string&, const std::string&) {
+        if (requests++ == 0) {
+            return test::MockResponse{502, "{}", {}};
+        }
+        return test::MockResponse{200, fillsReply(1000), {}};
+    });
+    auto info = client(server);
+
+    SymbolTable symbols;
+    size_t delivered = 0;
+    EXPECT_EQ(info->userFillsStream(USER, symbols, [&delivered](const Fill&) { ++delivered; }), 1u);
+    EXPECT_EQ(delivered, 1u);
+    EXPECT_EQ(requests, 2);
+}
+
+TEST_F(RetryTest, HedgedStreamDeliversOneBody) {
+    std::atomic<int> requests{0};
+    test::MockServer server([&](const std::string&, const std::string&) {
+        if (requests++ == 0) {
+            std::this_thread::sleep_for(600ms);
+        }
+        return test::MockResponse{200, fillsReply(1000), {}};
+    });
+    policy_.hedge = true;
+    auto info = client(server);
+
+    SymbolTable symbols;
+    size_t delivered = 0;
+    auto start = Clock::now();
+    EXPECT_EQ(info->userFillsStream(USER, symbols, [&delivered](const Fill&) { ++delivered; }), 1u);
+    EXPECT_LT(Clock::now() - start, 400ms);
+    EXPECT_EQ(delivered, 1u);
+    EXPECT_EQ(summary(*info, "userFills").hedge_wins, 1u);
+}
+
+TEST_F(RetryTest, RetriesAndHedgesBatchedQueries) {
+    // Window 0 fails once, window 2's first request stalls
+    std::mutex mutex;
+    std::map<int64_t, int> requests;
+    test::MockServer server([&](const std::string&, const std::string& body) {
+        int64_t start = nlohmann::json::parse(body)["startTime"];
+        int seen;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            seen = requests[start]++;
+        }
+        if (start == 0 && seen == 0) {
+            return test::MockResponse{503, "{}", {}};
+        }
+        if (start == 2000 && seen == 0) {
+            std::this_thread::sleep_for(600ms);
+        }
+        return test::MockResponse{200, fillsReply(start), {}};
+    });
+    policy_.hedge = true;
+    auto info = client(server);
+
+    SymbolTable symbols;
+    std::vector<int> fills(3, 0);
+    auto start = Clock::now();
+    info->userFillsByTimeWindows(USER, {{0, 999}, {1000, 1999}, {2000, 2999}}, symbols,
+                                 [&fills](size_t window, const Fill&) { ++fills[window]; }, 2);
+    EXPECT_LT(Clock::now() - start, 400ms);
+    EXPECT_EQ(fills, std::vector<int>({1, 1, 1}));
+
+    TransferSummary stats = summary(*info, "userFillsByTime");
+    EXPECT_EQ(stats.retries, 1u);
+    EXPECT_EQ(stats.hedges, 1u);
+    EXPECT_EQ(stats.hedge_wins, 1u);
+}
+
+} // namespace
+} // namespace hyperliquid